@@ -113,7 +113,7 @@ def normalize_inputs(request: InferRequestBase, inputs: dict) -> dict:
 class InferRequest(InferRequestBase):
     """InferRequest class represents infer request which can be run in asynchronous or synchronous manners."""
 
-    def infer(self, inputs: Any = None) -> dict:
+    def infer(self, inputs: Any = None, share_outputs: bool = False) -> dict:
         """Infers specified input(s) in synchronous mode.
 
         Blocks all methods of InferRequest while request is running.
@@ -137,31 +137,35 @@ class InferRequest(InferRequestBase):
 
         :param inputs: Data to be set on input tensors.
         :type inputs: Any, optional
+        :param share_outputs: If `True`, results are numpy views on the output tensors memory
+                              instead of copies. The views are overwritten by the next inference
+                              of this InferRequest.
+        :type share_outputs: bool, optional
         :return: Dictionary of results from output tensors with ports as keys.
         :rtype: Dict[openvino.runtime.ConstOutput, numpy.array]
         """
         # If inputs are empty, pass empty dictionary.
         if inputs is None:
-            return super().infer({})
+            return super().infer({}, share_outputs)
         # If inputs are dict, normalize dictionary and call infer method.
         elif isinstance(inputs, dict):
-            return super().infer(normalize_inputs(self, inputs))
+            return super().infer(normalize_inputs(self, inputs), share_outputs)
         # If inputs are list or tuple, enumarate inputs and save them as dictionary.
         # It is an extension of above branch with dict inputs.
         elif isinstance(inputs, (list, tuple)):
-            return super().infer(normalize_inputs(self, {index: input for index, input in enumerate(inputs)}))
+            return super().infer(normalize_inputs(self, {index: input for index, input in enumerate(inputs)}), share_outputs)
         # If inputs are Tensor, call infer method directly.
         elif isinstance(inputs, Tensor):
-            return super().infer(inputs)
+            return super().infer(inputs, share_outputs)
         # If inputs are single numpy array or scalars, use helper function to copy them
         # directly to Tensor or create temporary Tensor to pass into the InferRequest.
         # Pass empty dictionary to infer method, inputs are already set by helper function.
         elif isinstance(inputs, (np.ndarray, np.number, int, float)):
             update_tensor(inputs, self)
-            return super().infer({})
+            return super().infer({}, share_outputs)
         elif hasattr(inputs, "__array__"):
             update_tensor(np.array(inputs, copy=True), self)
-            return super().infer({})
+            return super().infer({}, share_outputs)
         else:
             raise TypeError(f"Incompatible inputs of type: {type(inputs)}")
 
@@ -214,6 +218,36 @@ class InferRequest(InferRequestBase):
         else:
             raise TypeError(f"Incompatible inputs of type: {type(inputs)}")
 
+    def set_output_arrays(self, outputs: dict) -> None:
+        """Binds preallocated numpy arrays as output tensors.
+
+        Inference writes results directly to the arrays memory, so no copies are made.
+        The arrays are kept alive by this InferRequest object.
+
+        The allowed types of keys in the `outputs` dictionary are:
+
+        (1) `int`
+        (2) `str`
+        (3) `openvino.runtime.ConstOutput`
+
+        :param outputs: C_CONTIGUOUS numpy arrays of the outputs element types and shapes.
+        :type outputs: Dict[Union[int, str, openvino.runtime.ConstOutput], numpy.array]
+        """
+        # Tensors do not own the arrays memory, keep the arrays alive while they are bound
+        if not hasattr(self, "_output_arrays"):
+            self._output_arrays: Dict[Union[str, int, ConstOutput], np.ndarray] = {}
+        for key, array in outputs.items():
+            if not isinstance(array, np.ndarray):
+                raise TypeError(f"Incompatible output data of type {type(array)} under {key} key!")
+            tensor = Tensor(array, shared_memory=True)
+            if isinstance(key, int):
+                self.set_output_tensor(key, tensor)
+            elif isinstance(key, (str, ConstOutput)):
+                self.set_tensor(key, tensor)
+            else:
+                raise TypeError(f"Incompatible key type for output: {key}")
+            self._output_arrays[key] = array
+
 
 class CompiledModel(CompiledModelBase):
     """CompiledModel class.
@@ -232,7 +266,11 @@ class CompiledModel(CompiledModelBase):
         """
         return InferRequest(super().create_infer_request())
 
-    def infer_new_request(self, inputs: Union[dict, list, tuple, Tensor, np.ndarray] = None) -> dict:
+    def infer_new_request(
+        self,
+        inputs: Union[dict, list, tuple, Tensor, np.ndarray] = None,
+        share_outputs: bool = False,
+    ) -> dict:
         """Infers specified input(s) in synchronous mode.
 
         Blocks all methods of CompiledModel while request is running.
@@ -258,19 +296,22 @@ class CompiledModel(CompiledModelBase):
 
         :param inputs: Data to be set on input tensors.
         :type inputs: Union[Dict[keys, values], List[values], Tuple[values], Tensor, numpy.array], optional
+        :param share_outputs: If `True`, results are numpy views on the output tensors memory
+                              instead of copies.
+        :type share_outputs: bool, optional
         :return: Dictionary of results from output tensors with ports as keys.
         :rtype: Dict[openvino.runtime.ConstOutput, numpy.array]
         """
         # It returns wrapped python InferReqeust and then call upon
         # overloaded functions of InferRequest class
-        return self.create_infer_request().infer(inputs)
+        return self.create_infer_request().infer(inputs, share_outputs)
 
-    def __call__(self, inputs: Optional[Union[dict, list]] = None) -> dict:
+    def __call__(self, inputs: Optional[Union[dict, list]] = None, share_outputs: bool = False) -> dict:
         """Callable infer wrapper for CompiledModel.
 
         Take a look at `infer_new_request` for reference.
         """
-        return self.infer_new_request(inputs)
+        return self.infer_new_request(inputs, share_outputs)
 
 
 class AsyncInferQueue(AsyncInferQueueBase):
@@ -353,6 +394,42 @@ class AsyncInferQueue(AsyncInferQueueBase):
         else:
             raise TypeError(f"Incompatible inputs of type: {type(inputs)}")
 
+    def start_async_many(
+        self,
+        inputs: Iterable[Any],
+        userdata: Optional[Iterable[Any]] = None,
+    ) -> None:
+        """Run asynchronous inference of several jobs using the next available InferRequests from the pool.
+
+        Submitting jobs in one call avoids per-job Python overhead of `start_async`.
+        Each item of `inputs` describes inputs of one job and accepts the same
+        types as `inputs` of `start_async`, numpy data is copied to new Tensors.
+
+        :param inputs: Data to be set on input tensors, one item per job.
+        :type inputs: Iterable[Any]
+        :param userdata: Any data that will be passed to a callback, one item per job.
+        :type userdata: Iterable[Any], optional
+        """
+
+        def to_tensor(value: Any) -> Tensor:
+            if isinstance(value, Tensor):
+                return value
+            if isinstance(value, (np.ndarray, np.number, int, float)) or hasattr(value, "__array__"):
+                return Tensor(np.array(value, copy=True))
+            raise TypeError(f"Incompatible input data of type {type(value)}!")
+
+        jobs = []
+        for job_inputs in inputs:
+            if job_inputs is None:
+                jobs.append({})
+            elif isinstance(job_inputs, dict):
+                jobs.append({key: to_tensor(value) for key, value in job_inputs.items()})
+            elif isinstance(job_inputs, (list, tuple)):
+                jobs.append({index: to_tensor(value) for index, value in enumerate(job_inputs)})
+            else:
+                jobs.append({0: to_tensor(job_inputs)})
+        super().start_async_many(jobs, [] if userdata is None else list(userdata))
+
 
 class Core(CoreBase):
     """Core class represents OpenVINO runtime Core entity.
@@ -12,6 +12,8 @@
 #include <mutex>
 #include <queue>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include "pyopenvino/core/common.hpp"
@@ -41,6 +43,23 @@ public:
     }
 
     ~AsyncInferQueue() {
+        if (m_delivery_thread.joinable()) {
+            // release GIL to let the delivery thread finish the last batch
+            py::gil_scoped_release release;
+            for (auto&& request : m_requests) {
+                try {
+                    request.m_request.wait();
+                } catch (...) {
+                    // the failure of the last run is passed to the batched callback, the destructor must not throw
+                }
+            }
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stop_delivery = true;
+            }
+            m_completions_cv.notify_one();
+            m_delivery_thread.join();
+        }
         m_requests.clear();
     }
 
@@ -79,7 +98,13 @@ public:
             request.m_request.wait();
         }
         // acquire the mutex to access m_errors
-        std::lock_guard<std::mutex> lock(m_mutex);
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (m_delivery_thread.joinable()) {
+            // requests become idle only after their completions are delivered to Python
+            m_cv.wait(lock, [this] {
+                return m_idle_handles.size() == m_requests.size();
+            });
+        }
         if (m_errors.size() > 0)
             throw m_errors.front();
     }
@@ -151,6 +176,97 @@ public:
         }
     }
 
+    void set_batched_callbacks(py::function f_callback) {
+        {
+            // release GIL to wait for requests which might be delivering completions
+            py::gil_scoped_release release;
+            for (auto&& request : m_requests) {
+                request.m_request.wait();
+            }
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_batch_callback = f_callback;
+        }
+        for (size_t handle = 0; handle < m_requests.size(); handle++) {
+            m_requests[handle].m_request.set_callback([this, handle](std::exception_ptr exception_ptr) {
+                *m_requests[handle].m_end_time = Time::now();
+                {
+                    // acquire the mutex to access m_completions
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_completions.emplace_back(handle, exception_ptr);
+                }
+                // Wake up the delivery thread
+                m_completions_cv.notify_one();
+            });
+        }
+        if (!m_delivery_thread.joinable()) {
+            m_delivery_thread = std::thread([this] {
+                deliver_completions();
+            });
+        }
+    }
+
+    // Delivers completions collected since the previous batch to Python with a single GIL acquisition
+    void deliver_completions() {
+        std::vector<std::pair<size_t, std::exception_ptr>> completions;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_completions_cv.wait(lock, [this] {
+                    return m_stop_delivery || !m_completions.empty();
+                });
+                if (m_completions.empty())
+                    return;
+                completions.swap(m_completions);
+            }
+            {
+                py::gil_scoped_acquire acquire;
+                try {
+                    py::list batch;
+                    for (auto&& completion : completions) {
+                        batch.append(py::make_tuple(m_requests[completion.first],
+                                                    m_user_ids[completion.first],
+                                                    get_error(completion.second)));
+                    }
+                    if (batch.size() > 0) {
+                        m_batch_callback(batch);
+                    }
+                } catch (const py::error_already_set& py_error) {
+                    assert(py_error.type());
+                    // acquire the mutex to access m_errors
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_errors.push(py_error);
+                }
+            }
+            {
+                // acquire the mutex to access m_idle_handles
+                std::lock_guard<std::mutex> lock(m_mutex);
+                for (auto&& completion : completions) {
+                    m_idle_handles.push(completion.first);
+                }
+            }
+            // Notify locks in getIdleRequestId() and wait_all()
+            m_cv.notify_all();
+            completions.clear();
+        }
+    }
+
+    // Returns None for the successful run or the RuntimeError describing the failure, the GIL must be held
+    static py::object get_error(const std::exception_ptr& exception_ptr) {
+        if (exception_ptr == nullptr)
+            return py::none();
+        std::string message;
+        try {
+            std::rethrow_exception(exception_ptr);
+        } catch (const std::exception& e) {
+            message = e.what();
+        } catch (...) {
+            message = "Unknown exception";
+        }
+        return py::reinterpret_borrow<py::object>(PyExc_RuntimeError)(message);
+    }
+
     // AsyncInferQueue is the owner of all requests. When AsyncInferQueue is destroyed,
     // all of requests are destroyed as well.
     std::vector<InferRequestWrapper> m_requests;
@@ -159,6 +275,12 @@ public:
     std::mutex m_mutex;
     std::condition_variable m_cv;
     std::queue<py::error_already_set> m_errors;
+    // Batched callbacks: completions of requests waiting for the delivery thread
+    std::vector<std::pair<size_t, std::exception_ptr>> m_completions;
+    std::condition_variable m_completions_cv;
+    py::function m_batch_callback;
+    std::thread m_delivery_thread;
+    bool m_stop_delivery = false;
 };
 
 void regclass_AsyncInferQueue(py::module m) {
@@ -266,6 +388,48 @@ void regclass_AsyncInferQueue(py::module m) {
             GIL is released while waiting for the next available InferRequest.
         )");
 
+    // Submits several jobs in one call, the GIL is released while waiting for idle InferRequests.
+    cls.def(
+        "start_async_many",
+        [](AsyncInferQueue& self, const std::vector<py::dict>& inputs, const py::list& userdata) {
+            if (!userdata.empty() && userdata.size() != inputs.size()) {
+                throw py::value_error("Number of userdata objects (" + std::to_string(userdata.size()) +
+                                      ") does not match number of inputs (" + std::to_string(inputs.size()) + ")!");
+            }
+            for (size_t job = 0; job < inputs.size(); job++) {
+                auto handle = self.get_idle_request_id();
+                {
+                    std::lock_guard<std::mutex> lock(self.m_mutex);
+                    self.m_idle_handles.pop();
+                }
+                // Set new inputs label/id from user
+                self.m_user_ids[handle] = userdata.empty() ? py::none() : py::object(userdata[job]);
+                // Update inputs if there are any
+                Common::set_request_tensors(self.m_requests[handle].m_request, inputs[job]);
+                // Now GIL can be released - we are NOT working with Python objects in this block
+                {
+                    py::gil_scoped_release release;
+                    *self.m_requests[handle].m_start_time = Time::now();
+                    // Start InferRequest in asynchronus mode
+                    self.m_requests[handle].m_request.start_async();
+                }
+            }
+        },
+        py::arg("inputs"),
+        py::arg("userdata"),
+        R"(
+            Run asynchronous inference of several jobs using the next available InferRequests.
+
+            :param inputs: Data to set on input tensors of InferRequests, one dictionary per job.
+            :type inputs: List[dict[Union[int, str, openvino.runtime.ConstOutput] : openvino.runtime.Tensor]]
+            :param userdata: Data passed to a callback, one object per job. If empty,
+                             `None` is passed for every job.
+            :type userdata: List[Any]
+            :rtype: None
+
+            GIL is released while waiting for the next available InferRequest.
+        )");
+
     cls.def("is_ready",
             &AsyncInferQueue::_is_ready,
             R"(
@@ -318,6 +482,32 @@ void regclass_AsyncInferQueue(py::module m) {
             :type callback: function
         )");
 
+    cls.def("set_batched_callback",
+            &AsyncInferQueue::set_batched_callbacks,
+            R"(
+            Sets unified callback on all InferRequests from queue's pool which
+            receives completed requests in batches.
+
+            Completions are collected on C++ side and delivered to Python from a
+            dedicated thread, the GIL is acquired once per batch instead of once
+            per request. Signature of such function should have one argument, a list
+            of tuples of InferRequest object, userdata connected to it and the error of
+            the inference: None if it succeeded, otherwise RuntimeError describing the failure.
+            InferRequests become available for new jobs after the callback returns.
+
+            .. code-block:: python
+
+                def f(completions):
+                    for request, userdata, error in completions:
+                        if error is None:
+                            print(request.output_tensors[0].data + userdata)
+
+                async_infer_queue.set_batched_callback(f)
+
+            :param callback: Any Python defined function that matches callback's requirements.
+            :type callback: function
+        )");
+
     cls.def(
         "__len__",
         [](AsyncInferQueue& self) {
@@ -243,8 +243,30 @@ uint32_t get_optimal_number_of_requests(const ov::CompiledModel& actual) {
     }
 }
 
-py::dict outputs_to_dict(const std::vector<ov::Output<const ov::Node>>& outputs, ov::InferRequest& request) {
+py::array array_from_tensor(ov::Tensor&& tensor) {
+    auto ov_type = tensor.get_element_type();
+    auto dtype = Common::ov_type_to_dtype().at(ov_type);
+    auto data = tensor.data();
+    // The array is a view on the tensor memory, the tensor is kept alive by the array base object
+    if (ov_type.bitwidth() < 8) {
+        auto byte_size = tensor.get_byte_size();
+        return py::array(dtype, byte_size, data, py::cast(std::move(tensor)));
+    }
+    auto shape = tensor.get_shape();
+    auto strides = tensor.get_strides();
+    return py::array(dtype, shape, strides, data, py::cast(std::move(tensor)));
+}
+
+py::dict outputs_to_dict(const std::vector<ov::Output<const ov::Node>>& outputs,
+                         ov::InferRequest& request,
+                         bool share_outputs) {
     py::dict res;
+    if (share_outputs) {
+        for (const auto& out : outputs) {
+            res[py::cast(out)] = array_from_tensor(request.get_tensor(out));
+        }
+        return res;
+    }
     for (const auto& out : outputs) {
         ov::Tensor t{request.get_tensor(out)};
         switch (t.get_element_type()) {
@@ -6,6 +6,7 @@ from collections.abc import Iterable
 from copy import deepcopy
 import numpy as np
 import os
+import gc
 import pytest
 import datetime
 import time
@@ -981,3 +982,93 @@ def test_convert_infer_request(device):
     with pytest.raises(TypeError) as e:
         deepcopy(res)
     assert "cannot deepcopy 'openvino.runtime.ConstOutput' object." in str(e)
+
+
+def test_infer_share_outputs(device):
+    request, arr_1, arr_2 = create_simple_request_and_inputs(device)
+
+    res = request.infer([arr_1, arr_2], share_outputs=True)
+    output = list(res.values())[0]
+    assert np.array_equal(output, arr_1 + arr_2)
+    # results are views on the output tensor memory
+    assert not output.flags["OWNDATA"]
+    assert np.shares_memory(output, request.get_output_tensor().data)
+
+    res = request.infer([arr_1, arr_2])
+    assert list(res.values())[0].flags["OWNDATA"]
+
+
+def test_set_output_arrays(device):
+    request, arr_1, arr_2 = create_simple_request_and_inputs(device)
+
+    output = np.zeros([2, 2], dtype=np.float32)
+    request.set_output_arrays({0: output})
+    request.infer([arr_1, arr_2])
+    assert np.array_equal(output, arr_1 + arr_2)
+
+
+def test_infer_queue_batched_callback(device):
+    jobs = 16
+    core = Core()
+    param = ops.parameter([10])
+    model = Model(ops.relu(param), [param])
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, 4)
+    jobs_done = [False] * jobs
+    batches = []
+
+    def callback(completions):
+        batches.append(len(completions))
+        for request, job_id, error in completions:
+            assert error is None
+            assert np.array_equal(request.get_output_tensor().data, np.full(10, job_id, dtype=np.float32))
+            jobs_done[job_id] = True
+
+    infer_queue.set_batched_callback(callback)
+    infer_queue.start_async_many([np.full(10, i, dtype=np.float32) for i in range(jobs)], range(jobs))
+    infer_queue.wait_all()
+    assert all(jobs_done)
+    assert sum(batches) == jobs
+
+
+def test_infer_queue_batched_callback_fail_in_inference(device):
+    # every job gets its own request, so the failures are not reported while the jobs are submitted
+    jobs = 4
+    core = Core()
+    data = ops.parameter([5, 2], dtype=np.float32, name="data")
+    indexes = ops.parameter(Shape([3, 2]), dtype=np.int32, name="indexes")
+    emb = ops.embedding_bag_packed_sum(data, indexes)
+    model = Model(emb, [data, indexes])
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, jobs)
+    failed_jobs = []
+
+    def callback(completions):
+        for _, job_id, error in completions:
+            assert isinstance(error, RuntimeError)
+            assert "has invalid embedding bag index:" in str(error)
+            failed_jobs.append(job_id)
+
+    infer_queue.set_batched_callback(callback)
+    data_tensor = Tensor(np.arange(10).reshape((5, 2)).astype(np.float32))
+    indexes_tensor = Tensor(np.array([[100, 101], [102, 103], [104, 105]], dtype=np.int32))
+    infer_queue.start_async_many([{"data": data_tensor, "indexes": indexes_tensor}] * jobs, range(jobs))
+    with pytest.raises(RuntimeError) as e:
+        infer_queue.wait_all()
+    assert "has invalid embedding bag index:" in str(e.value)
+
+    # the queue is deleted with the failed requests, it delivers the remaining completions
+    del infer_queue
+    gc.collect()
+    assert sorted(failed_jobs) == list(range(jobs))
+
+
+def test_infer_queue_start_async_many_wrong_userdata(device):
+    core = Core()
+    param = ops.parameter([10])
+    model = Model(ops.relu(param), [param])
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, 2)
+    with pytest.raises(ValueError) as e:
+        infer_queue.start_async_many([np.ones(10, dtype=np.float32)] * 2, [0])
+    assert "does not match number of inputs" in str(e.value)
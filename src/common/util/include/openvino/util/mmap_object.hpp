@@ -0,0 +1,49 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for definition of abstraction over platform specific shared memory map objects
+ * @file mmap_object.hpp
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "openvino/util/util.hpp"
+
+namespace ov {
+namespace util {
+
+/**
+ * @brief Read-only memory mapped file. The mapping is released on the object destruction.
+ */
+class MappedMemory {
+public:
+    virtual char* data() noexcept = 0;
+    virtual size_t size() const noexcept = 0;
+    virtual ~MappedMemory() = default;
+};
+
+/**
+ * @brief Maps a whole file into memory in read-only mode.
+ * @param path Path to the file
+ * @return Reference to the mapped memory
+ * @throws std::runtime_error if the file can not be opened or mapped
+ */
+std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path);
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+/**
+ * @brief Maps a whole file with the wide char name specified into memory in read-only mode.
+ * @param path Path to the file
+ * @return Reference to the mapped memory
+ * @throws std::runtime_error if the file can not be opened or mapped
+ */
+std::shared_ptr<MappedMemory> load_mmap_object(const std::wstring& path);
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+}  // namespace util
+}  // namespace ov
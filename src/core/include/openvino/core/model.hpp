@@ -179,6 +179,13 @@ public:
 
     void validate_nodes_and_infer_types() const;
 
+    /// \brief Validates and infers types only of the nodes changed since the previous validation
+    /// and of the nodes downstream of them. The new nodes, replaced inputs and changed output types
+    /// are tracked automatically, other in-place changes must be marked with
+    /// Node::invalidate_validation(). The sub-graph operations are revalidated when the
+    /// nodes of their bodies are changed.
+    void validate_changed_nodes_and_infer_types() const;
+
     /// \brief Returns the sum of the size of all nodes in the graph plus the size of
     /// all constant data. This has little value beyond comparing the relative size of
     /// graphs and should not be considered the actual memory consumption of a graph.
@@ -539,6 +546,16 @@ private:
     /// model and registers them, otherwise checks all the Parameters are registered.
     void prerequirements(bool detect_variables, bool detect_parameters);
 
+    /// \brief Validates the model nodes, see validate_nodes_and_infer_types()
+    /// \param only_changed If this flag is true, only the nodes which require the validation
+    /// and the nodes downstream of them are revalidated.
+    void validate_nodes(bool only_changed) const;
+
+    /// \brief Checks the node or the nodes of its sub-graphs are changed since the previous validation.
+    /// The sub-graphs are edited by the transformations without marking the sub-graph operation,
+    /// so the changed nodes mark the shared info of the sub-graph models too.
+    static bool requires_validation(const Node& node);
+
     static std::atomic<size_t> m_next_instance_id;
     std::string m_name;
     const std::string m_unique_name;
@@ -281,6 +281,10 @@ public:
         invalidate_values();
         validate_and_infer_types();
     }
+    /// \brief Marks the node to be revalidated by the next incremental validation of the model,
+    /// see Model::validate_changed_nodes_and_infer_types(). The new nodes and the input changes
+    /// are tracked automatically; attributes changed in place must be marked with this call.
+    void invalidate_validation();
     /// \brief Get the string name for the type of the node, such as `Add` or `Multiply`.
     ///        The class name, must not contain spaces as it is used for codegen.
     /// \returns A const reference to the node's type name
@@ -528,6 +532,9 @@ private:
     // update of this field by having specific method with mutex.
     void insert_info(std::shared_ptr<SharedRTInfo> info);
     std::mutex m_insert_mutex;
+
+    // The node has to be revalidated by the incremental model validation
+    bool m_validation_required{true};
 };
 
 using NodeTypeInfo = Node::type_info_t;
@@ -51,6 +51,7 @@ public:
     }
     void set_element_type(const element::Type& element_type) {
         m_element_type = element_type;
+        invalidate_validation();
     }
 
     /// \brief Returns current layout, or empty Layout if it is not set
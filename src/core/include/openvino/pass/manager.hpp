@@ -70,6 +70,13 @@ public:
     /// \param new_state Value "true" enables Validate pass run; "false", otherwise
     void set_per_pass_validation(bool new_state);
 
+    /// \brief Set flag to revalidate only the changed nodes and the nodes downstream of them
+    /// by the Validate passes, see Model::validate_changed_nodes_and_infer_types()
+    /// It is disabled by default, because the passes changing the node attributes in place have
+    /// to mark such nodes with Node::invalidate_validation() to be used with it.
+    /// \param new_state Value "true" enables the incremental validation; "false", otherwise
+    void set_incremental_validation(bool new_state);
+
     /// \brief Callback is a lambda function that can be used by registered transformations.
     /// The main purpose of this callback is to provide a way for plugins to disable/enable
     /// transformations based on some conditions. In some cases plugins may want not to
@@ -123,6 +130,7 @@ protected:
     std::vector<std::shared_ptr<PassBase>> m_pass_list;
     bool m_visualize = false;
     bool m_per_pass_validation = true;
+    bool m_incremental_validation = false;
 };
 }  // namespace pass
 }  // namespace ov
@@ -46,6 +46,7 @@ void ov::descriptor::Input::replace_output(Output& new_output) {
              [](const std::shared_ptr<SharedRTInfo>& info) {
                  info->set_use_topological_cache(false);
              });
+    m_node->invalidate_validation();
 }
 
 void ov::descriptor::Input::replace_output(const std::shared_ptr<ov::Node>& node, size_t i) {
@@ -22,6 +22,7 @@
 #include "openvino/core/except.hpp"
 #include "openvino/core/partial_shape.hpp"
 #include "openvino/op/parameter.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
 #include "openvino/op/util/op_types.hpp"
 #include "openvino/op/util/variable_context.hpp"
 #include "openvino/op/util/variable_extension.hpp"
@@ -208,7 +209,29 @@ void ov::Model::prerequirements(bool detect_variables, bool detect_parameters) {
 
 void ov::Model::validate_nodes_and_infer_types() const {
     OV_ITT_SCOPED_TASK(ov::itt::domains::core, "Model::validate_nodes_and_infer_types");
+    validate_nodes(false);
+}
+
+void ov::Model::validate_changed_nodes_and_infer_types() const {
+    OV_ITT_SCOPED_TASK(ov::itt::domains::core, "Model::validate_changed_nodes_and_infer_types");
+    validate_nodes(true);
+}
+
+bool ov::Model::requires_validation(const Node& node) {
+    if (node.m_validation_required)
+        return true;
+    if (const auto sub_graph_op = dynamic_cast<const ov::op::util::MultiSubGraphOp*>(&node)) {
+        for (size_t i = 0; i < sub_graph_op->get_internal_subgraphs_size(); ++i) {
+            // the changed body nodes mark the body, so its nodes are not walked here
+            const auto& body = sub_graph_op->get_function(static_cast<int>(i));
+            if (body && body->m_shared_rt_info->get_validation_required())
+                return true;
+        }
+    }
+    return false;
+}
 
+void ov::Model::validate_nodes(bool only_changed) const {
     struct Counter {
         int cnt_assign = 0;
         int cnt_read_val = 0;
@@ -217,9 +240,20 @@ void ov::Model::validate_nodes_and_infer_types() const {
     std::stringstream unregistered_parameters;
     std::stringstream unregistered_variables;
     std::unordered_set<const ov::descriptor::Tensor*> tensors;
+    // the nodes revalidated in this run, their consumers are revalidated too
+    std::unordered_set<const Node*> revalidated;
 
     for (auto& node : get_ordered_ops()) {
-        node->revalidate_and_infer_types();
+        bool revalidate = !only_changed || requires_validation(*node);
+        for (size_t i = 0; !revalidate && i < node->get_input_size(); ++i) {
+            revalidate = revalidated.count(node->get_input_node_ptr(i)) != 0;
+        }
+        if (revalidate) {
+            node->revalidate_and_infer_types();
+            node->m_validation_required = false;
+            if (only_changed)
+                revalidated.insert(node.get());
+        }
         for (const auto& output : node->outputs()) {
             const auto& tensor = output.get_tensor();
             // Skip results outputs tensors because result_input_tensor == result_output_tensor
@@ -242,6 +276,7 @@ void ov::Model::validate_nodes_and_infer_types() const {
             pair_checker[read_value->get_variable().get()].cnt_read_val++;
         }
     }
+    m_shared_rt_info->set_validation_required(false);
 
     if (!unregistered_parameters.str().empty())
         throw ov::Exception("Model references undeclared parameters: " + unregistered_parameters.str());
@@ -298,6 +333,9 @@ std::vector<shared_ptr<ov::Node>> ov::Model::get_ordered_ops() const {
     for_each(order.cbegin(), order.cend(), [this](const shared_ptr<Node>& node) {
         m_cached_ordered_ops.push_back(node);
         node->insert_info(m_shared_rt_info);
+        // the node could be marked before it was added to the model
+        if (node->m_validation_required)
+            m_shared_rt_info->set_validation_required(true);
     });
     m_cached_output_names.clear();
     m_cached_op_names.clear();
@@ -183,6 +183,7 @@ void ov::Node::set_arguments(const OutputVector& arguments) {
     for_each(this->m_shared_rt_info.cbegin(), this->m_shared_rt_info.cend(), [](std::shared_ptr<SharedRTInfo> info) {
         info->set_use_topological_cache(false);
     });
+    invalidate_validation();
 }
 
 ov::descriptor::Input& ov::Node::get_input_descriptor(size_t position) {
@@ -251,9 +252,24 @@ void ov::Node::set_input_is_relevant_to_value(size_t i, bool relevant) {
     m_inputs[i].m_is_relevant_to_value = relevant;
 }
 
+void ov::Node::invalidate_validation() {
+    m_validation_required = true;
+    for_each(m_shared_rt_info.cbegin(), m_shared_rt_info.cend(), [](const std::shared_ptr<SharedRTInfo>& info) {
+        info->set_validation_required(true);
+    });
+}
+
 void ov::Node::set_output_type(size_t i, const element::Type& element_type, const PartialShape& pshape) {
+    auto& output = get_output_descriptor(i);
+    const auto& tensor = output.get_tensor();
+    if (tensor.get_element_type() != element_type || tensor.get_partial_shape() != pshape) {
+        // the consumers have to be revalidated even if the node is validated outside of the model validation
+        for (auto input : output.get_inputs()) {
+            input->get_raw_pointer_node()->invalidate_validation();
+        }
+    }
     OPENVINO_SUPPRESS_DEPRECATED_START
-    get_output_descriptor(i).get_tensor_ptr()->set_tensor_type(element_type, pshape);
+    output.get_tensor_ptr()->set_tensor_type(element_type, pshape);
     OPENVINO_SUPPRESS_DEPRECATED_END
 }
 
@@ -67,6 +67,7 @@ void op::Parameter::set_partial_shape(const PartialShape& partial_shape) {
                     get_layout().to_string(),
                     ". Layout is not compatible with shape");
     m_partial_shape = partial_shape;
+    invalidate_validation();
 }
 
 BWDCMP_RTTI_DEFINITION(ov::AttributeAdapter<ParameterVector>);
@@ -49,6 +49,10 @@ void ov::pass::Manager::set_per_pass_validation(bool new_state) {
     m_per_pass_validation = new_state;
 }
 
+void ov::pass::Manager::set_incremental_validation(bool new_state) {
+    m_incremental_validation = new_state;
+}
+
 void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
     NGRAPH_SUPPRESS_DEPRECATED_START
     OV_ITT_SCOPED_TASK(ov::itt::domains::core, "pass::Manager::run_passes");
@@ -93,7 +97,11 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
 
             if (dynamic_pointer_cast<Validate>(pass)) {
                 if (function_changed) {
-                    function_pass->run_on_model(func);
+                    if (m_incremental_validation) {
+                        func->validate_changed_nodes_and_infer_types();
+                    } else {
+                        function_pass->run_on_model(func);
+                    }
                     function_changed = false;
                 }
             } else {
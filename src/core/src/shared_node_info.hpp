@@ -11,7 +11,7 @@
 namespace ov {
 class SharedRTInfo {
 public:
-    SharedRTInfo() : m_use_topological_cache(false) {}
+    SharedRTInfo() : m_use_topological_cache(false), m_validation_required(true) {}
 
     void set_use_topological_cache(bool status) {
         m_use_topological_cache = status;
@@ -21,7 +21,18 @@ public:
         return m_use_topological_cache;
     }
 
+    // The flag is raised by the nodes marked for the incremental validation, so the model
+    // knows it has changed nodes without walking them
+    void set_validation_required(bool status) {
+        m_validation_required = status;
+    }
+
+    bool get_validation_required() const {
+        return m_validation_required;
+    }
+
 private:
     bool m_use_topological_cache;
+    bool m_validation_required;
 };
 }  // namespace ov
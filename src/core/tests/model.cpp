@@ -1972,3 +1972,60 @@ TEST(model, set_meta_information) {
     EXPECT_EQ(f->get_rt_info<std::string>({key, "test1"}), "1");
     EXPECT_EQ(f->get_rt_info<int>({key, "test1"}), 1);
 }
+
+TEST(model, validate_changed_nodes) {
+    auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
+    auto relu0 = std::make_shared<ov::opset8::Relu>(arg0);
+    auto arg1 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
+    auto convert1 = std::make_shared<ov::opset8::Convert>(arg1, ov::element::f16);
+    auto f = std::make_shared<ov::Model>(ov::OutputVector{relu0, convert1}, ov::ParameterVector{arg0, arg1});
+    f->validate_nodes_and_infer_types();
+
+    // the changed parameter shape is tracked
+    arg0->set_partial_shape(ov::PartialShape{2});
+    f->validate_changed_nodes_and_infer_types();
+    EXPECT_EQ(f->output(0).get_partial_shape(), ov::PartialShape{2});
+    EXPECT_EQ(f->output(1).get_partial_shape(), ov::PartialShape{1});
+
+    // the attribute changed in place is marked
+    convert1->set_convert_element_type(ov::element::i32);
+    convert1->invalidate_validation();
+    f->validate_changed_nodes_and_infer_types();
+    EXPECT_EQ(f->output(1).get_element_type(), ov::element::i32);
+
+    // the replaced input is tracked
+    auto arg2 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{4});
+    convert1->input(0).replace_source_output(arg2);
+    f->add_parameters({arg2});
+    f->validate_changed_nodes_and_infer_types();
+    EXPECT_EQ(f->output(1).get_partial_shape(), ov::PartialShape{4});
+    EXPECT_EQ(f->output(0).get_partial_shape(), ov::PartialShape{2});
+}
+
+TEST(model, validate_changed_nodes_of_body) {
+    auto then_arg = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
+    auto then_relu = std::make_shared<ov::opset8::Relu>(then_arg);
+    auto then_result = std::make_shared<ov::opset8::Result>(then_relu);
+    auto then_body = std::make_shared<ov::Model>(ov::ResultVector{then_result}, ov::ParameterVector{then_arg});
+    auto else_arg = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
+    auto else_result = std::make_shared<ov::opset8::Result>(else_arg);
+    auto else_body = std::make_shared<ov::Model>(ov::ResultVector{else_result}, ov::ParameterVector{else_arg});
+
+    auto arg = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
+    auto cond = ov::opset8::Constant::create(ov::element::boolean, ov::Shape{1}, {true});
+    auto if_op = std::make_shared<ov::opset8::If>(cond);
+    if_op->set_then_body(then_body);
+    if_op->set_else_body(else_body);
+    if_op->set_input(arg, then_arg, else_arg);
+    auto if_output = if_op->set_output(then_result, else_result);
+    auto relu = std::make_shared<ov::opset8::Relu>(if_output);
+    auto f = std::make_shared<ov::Model>(ov::OutputVector{relu}, ov::ParameterVector{arg});
+    f->validate_nodes_and_infer_types();
+    EXPECT_EQ(f->output(0).get_partial_shape(), ov::PartialShape{1});
+
+    // the body is edited without marking the If operation
+    auto then_concat = std::make_shared<ov::opset8::Concat>(ov::OutputVector{then_arg, then_arg}, 0);
+    ov::replace_node(then_relu, then_concat);
+    f->validate_changed_nodes_and_infer_types();
+    EXPECT_EQ(f->output(0).get_partial_shape(), ov::PartialShape{2});
+}
@@ -12,6 +12,8 @@
 #include "ngraph/graph_util.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "openvino/pass/manager.hpp"
 #include "util/test_tools.hpp"
 
 using namespace ngraph;
@@ -42,3 +44,41 @@ public:
     }
 };
 }  // namespace
+
+namespace {
+class ReplaceReluWithConcat : public ov::pass::ModelPass {
+public:
+    OPENVINO_RTTI("ReplaceReluWithConcat");
+    bool run_on_model(const std::shared_ptr<ov::Model>& model) override {
+        bool replaced = false;
+        for (const auto& node : model->get_ordered_ops()) {
+            if (!ov::is_type<ov::opset8::Relu>(node))
+                continue;
+            auto concat = std::make_shared<ov::opset8::Concat>(
+                ov::OutputVector{node->input_value(0), node->input_value(0)}, 0);
+            ov::replace_node(node, concat);
+            replaced = true;
+        }
+        return replaced;
+    }
+};
+}  // namespace
+
+TEST(pass_manager, incremental_validation) {
+    auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
+    auto relu = std::make_shared<ov::opset8::Relu>(arg0);
+    auto abs0 = std::make_shared<ov::opset8::Abs>(relu);
+    auto arg1 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{3});
+    auto abs1 = std::make_shared<ov::opset8::Abs>(arg1);
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{abs0, abs1}, ov::ParameterVector{arg0, arg1});
+
+    ov::pass::Manager manager;
+    manager.set_incremental_validation(true);
+    manager.register_pass<ReplaceReluWithConcat>();
+    manager.run_passes(model);
+
+    // the consumers of the replaced node are revalidated
+    EXPECT_EQ(abs0->get_output_partial_shape(0), ov::PartialShape{2});
+    EXPECT_EQ(model->output(0).get_partial_shape(), ov::PartialShape{2});
+    EXPECT_EQ(model->output(1).get_partial_shape(), ov::PartialShape{3});
+}
@@ -12,6 +12,7 @@
 
 #include "core/graph_cache.hpp"
 #include "core/model.hpp"
+#include "utils/tensor_external_data.hpp"
 #include "ngraph/function.hpp"
 #include "ngraph/op/parameter.hpp"
 #include "onnx_import/core/operator_set.hpp"
@@ -40,6 +41,9 @@ public:
     const std::string& model_dir() const {
         return m_model_dir;
     }
+    detail::MappedMemoryHandles get_mmap_cache() const {
+        return m_mmap_cache;
+    }
     const ParameterVector& get_ng_parameters() const {
         return m_parameters;
     }
@@ -57,6 +61,7 @@ protected:
     Graph(const std::string& model_dir,
           const std::shared_ptr<ONNX_NAMESPACE::ModelProto>& model,
           std::unique_ptr<GraphCache>&& cache,
+          detail::MappedMemoryHandles mmap_cache,
           ov::frontend::ExtensionHolder extensions = {});
 
     void set_friendly_names(const Node& onnx_node, const OutputVector& ng_subgraph_outputs) const;
@@ -77,6 +82,7 @@ protected:
 private:
     std::vector<Node> m_nodes;
     std::string m_model_dir;
+    detail::MappedMemoryHandles m_mmap_cache;
 };
 
 /// \brief      Representation of ONNX subgraph. It is used for example by ONNX Loop op.
@@ -7,6 +7,7 @@
 #include <onnx/onnx_pb.h>
 
 #include <algorithm>
+#include <cstdint>
 #include <utility>
 #include <vector>
 
@@ -105,10 +106,13 @@ public:
     };
 
     Tensor() = delete;
-    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor, const std::string& model_dir)
+    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor,
+                    const std::string& model_dir,
+                    detail::MappedMemoryHandles mmap_cache)
         : m_tensor_proto{&tensor},
           m_shape{std::begin(tensor.dims()), std::end(tensor.dims())},
-          m_model_dir{model_dir} {
+          m_model_dir{model_dir},
+          m_mmap_cache{mmap_cache} {
         if (m_shape == Shape{0}) {
             // It's possible to construct a tensor in ONNX with "dims: 0" property
             // Such tensor contains a scalar. This results in a Shape{0} stored in m_shape.
@@ -194,6 +198,9 @@ public:
         if (m_tensor_proto->has_segment()) {
             throw error::tensor::segments_unsupported{};
         }
+        if (has_external_data() && m_mmap_cache) {
+            return make_ng_constant_from_mmap(get_ng_type());
+        }
         switch (m_tensor_proto->data_type()) {
         case ONNX_NAMESPACE::TensorProto_DataType::TensorProto_DataType_BOOL:
             return make_ng_constant<char>(element::boolean);
@@ -227,6 +234,27 @@ public:
     }
 
 private:
+    std::shared_ptr<ngraph::op::Constant> make_ng_constant_from_mmap(const element::Type& type) const {
+        const auto tensor_external_data = detail::TensorExternalData(*m_tensor_proto);
+        const auto buffer = tensor_external_data.load_external_mmap_data(m_model_dir, m_mmap_cache);
+        if (buffer->size() < shape_size(m_shape) * type.size()) {
+            throw error::tensor::shape_doesnt_match_data_size{};
+        }
+        std::shared_ptr<ngraph::op::Constant> constant;
+        const auto alignment = std::max<size_t>(type.size(), 1);
+        if (reinterpret_cast<uintptr_t>(buffer->get_ptr()) % alignment != 0) {
+            // The offset of the tensor in the file is not aligned for its element type, so the data is copied
+            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, buffer->get_ptr());
+        } else {
+            // The constant refers to the mapped file directly, so the external data is never copied
+            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, buffer);
+        }
+        if (m_tensor_proto->has_name()) {
+            constant->set_friendly_name(get_name());
+        }
+        return constant;
+    }
+
     template <typename T,
               typename std::enable_if<std::is_same<T, float>::value || std::is_same<T, double>::value ||
                                           std::is_same<T, int32_t>::value || std::is_same<T, int64_t>::value ||
@@ -259,6 +287,17 @@ private:
                                       bool>::type = true>
     std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const {
         std::shared_ptr<default_opset::Constant> constant{nullptr};
+        if (m_tensor_proto->has_raw_data() && !has_external_data()) {
+            // raw_data already has the memory layout of the constant, so it is copied once without
+            // an intermediate std::vector
+            if (get_data_size() == shape_size(m_shape)) {
+                constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data_ptr());
+                if (m_tensor_proto->has_name()) {
+                    constant->set_friendly_name(get_name());
+                }
+                return constant;
+            }
+        }
         auto data = get_data<T>();
         auto data_size = data.size();
         if (data_size == shape_size(m_shape)) {
@@ -331,6 +370,7 @@ private:
     const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
     Shape m_shape;
     std::string m_model_dir;
+    detail::MappedMemoryHandles m_mmap_cache;
 };
 
 inline std::ostream& operator<<(std::ostream& outs, const Tensor& tensor) {
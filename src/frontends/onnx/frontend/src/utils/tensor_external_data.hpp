@@ -6,17 +6,41 @@
 
 #include <onnx/onnx_pb.h>
 
+#include <map>
+#include <memory>
+#include <string>
+
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "openvino/util/mmap_object.hpp"
+
 namespace ngraph {
 namespace onnx_import {
 namespace detail {
+/// \brief  Files with external data mapped into memory, shared by all tensors of a model
+using MappedMemoryHandles = std::shared_ptr<std::map<std::string, std::shared_ptr<ov::util::MappedMemory>>>;
+
 /// \brief  Helper class used to load tensor data from external files
 class TensorExternalData {
 public:
+    using Buffer = std::shared_ptr<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>;
+
     TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor);
 
+    /// \brief      Map external data from tensor passed to constructor into memory
+    ///
+    /// \note       Every external data file is mapped only once and the mapping is stored in the cache,
+    ///             so tensors located in the same file share the mapping.
+    /// \note       If mapping data from external files fails,
+    ///             the invalid_external_data exception is thrown.
+    ///
+    /// \param      model_dir  Directory of the model the external data paths are relative to
+    /// \param      cache      Cache of the mapped external data files
+    ///
+    /// \return     Buffer pointing to the external data inside of the mapped file
+    Buffer load_external_mmap_data(const std::string& model_dir, MappedMemoryHandles cache) const;
+
     /// \brief      Load external data from tensor passed to constructor
     ///
-    /// \note       If read data from external file fails,
     /// \note       If reading data from external files fails,
     ///             the invalid_external_data exception is thrown.
     ///
@@ -93,6 +93,36 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_external_two_tensors_data_in_the_same_file) {
     test_case.run();
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_misaligned_tensors_data_in_the_same_file) {
+    const auto function = onnx_import::import_onnx_model(
+        file_util::path_join(CommonTestUtils::getExecutableDirectory(),
+                             SERIALIZED_ZOO,
+                             "onnx/external_data/external_data_misaligned_tensors_in_the_same_file.onnx"));
+
+    std::map<std::string, std::shared_ptr<default_opset::Constant>> constants;
+    for (const auto& op : function->get_ordered_ops()) {
+        if (const auto constant = ov::as_type_ptr<default_opset::Constant>(op)) {
+            constants[constant->get_friendly_name()] = constant;
+        }
+    }
+    ASSERT_EQ(constants.size(), 3u);
+    // data_a and data_c are aligned, so both refer to the single mapping of the file at their offsets
+    const auto data_a = constants.at("data_a")->get_data_ptr<char>();
+    const auto data_c = constants.at("data_c")->get_data_ptr<char>();
+    EXPECT_EQ(data_c - data_a, 32);
+    // data_b starts at offset 14 which is not aligned for f32, so it is copied
+    const auto data_b = constants.at("data_b")->get_data_ptr<char>();
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(data_b) % sizeof(float), 0);
+    EXPECT_EQ(constants.at("data_b")->cast_vector<float>(), (std::vector<float>{4.f, 5.f, 6.f}));
+
+    auto test_case = test::TestCase(function, s_device);
+    // data_a: {1, 2, 3}, data_b: {4, 5, 6}, data_c: {7, 8, 9} read from external file
+    test_case.add_input<float>({1.f, 1.f, 1.f});
+
+    test_case.add_expected_output<float>({13.f, 16.f, 19.f});
+    test_case.run();
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_external_invalid_external_data_exception) {
     try {
         auto function = onnx_import::import_onnx_model(
@@ -4,15 +4,18 @@
 
 #include "input_model.hpp"
 
+#include <cstring>
 #include <fstream>
 #include <queue>
 
 #include "decoder_proto.hpp"
 #include "framework.pb.h"
 #include "input_model.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/frontend/paddle/node_context.hpp"
 #include "openvino/opsets/opset7.hpp"
 #include "openvino/util/common_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "paddle_utils.hpp"
 #include "place.hpp"
 
@@ -59,7 +62,9 @@ public:
 private:
     void loadPlaces();
     template <typename T>
-    void loadConsts(const std::basic_string<T>& folder_with_weights, std::istream* weight_stream);
+    void loadConsts(const std::basic_string<T>& folder_with_weights,
+                    std::istream* weight_stream,
+                    const std::shared_ptr<ov::util::MappedMemory>& weights_mapping = nullptr);
     void createTempConsts();
     std::vector<std::shared_ptr<OpPlace>> determine_cut_nodes() const;
 
@@ -167,6 +172,44 @@ bool read_tensor(std::istream& is, char* data, size_t len) {
     return true;
 }
 
+// Locates the tensor record at the offset of the mapped parameters and moves the offset past the record.
+// The record has the same layout as the one read by read_tensor. The constant shares the mapped memory,
+// the data is copied only if it is not aligned for the element type.
+std::shared_ptr<opset7::Constant> read_mapped_tensor(const std::shared_ptr<ov::util::MappedMemory>& mapping,
+                                                     size_t& offset,
+                                                     const element::Type& type,
+                                                     const Shape& shape) {
+    const size_t size = mapping->size();
+    const size_t header_size = 16;
+    if (size < offset || size - offset < header_size + sizeof(uint32_t))
+        return nullptr;
+    uint32_t dims_len = 0;
+    std::memcpy(&dims_len, mapping->data() + offset + header_size, sizeof(dims_len));
+    const size_t data_offset = offset + header_size + sizeof(uint32_t) + dims_len;
+    const size_t data_length = shape_size(shape) * type.size();
+    if (size < data_offset || size - data_offset < data_length)
+        return nullptr;
+    offset = data_offset + data_length;
+
+    char* data = mapping->data() + data_offset;
+    const auto alignment = std::max<size_t>(type.size(), 1);
+    if (reinterpret_cast<uintptr_t>(data) % alignment != 0)
+        return opset7::Constant::create(type, shape, data);
+    auto buffer = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>(data,
+                                                                                                          data_length,
+                                                                                                          mapping);
+    return std::make_shared<opset7::Constant>(type, shape, buffer);
+}
+
+template <typename T>
+std::shared_ptr<ov::util::MappedMemory> map_weights(const std::basic_string<T>& path) {
+    try {
+        return ov::util::load_mmap_object(path);
+    } catch (const std::runtime_error&) {
+        return nullptr;
+    }
+}
+
 template <typename T>
 std::basic_string<T> get_const_path(const std::basic_string<T>& folder_with_weights, const std::string& name) {
     return folder_with_weights + paddle::get_path_sep<T>() + name;
@@ -182,16 +225,13 @@ std::basic_string<wchar_t> get_const_path(const std::basic_string<wchar_t>& fold
 #endif
 
 template <typename T>
-std::basic_string<T> get_model_path(const std::basic_string<T>& path, std::ifstream* weights_stream) {
+std::basic_string<T> get_model_path(const std::basic_string<T>& path, std::basic_string<T>* weights_file) {
     std::string model_file{path};
     std::string ext = ".pdmodel";
     if (ov::util::ends_with(model_file, ext)) {
         std::string params_ext = ".pdiparams";
-        std::string weights_file{path};
-        weights_file.replace(weights_file.size() - ext.size(), ext.size(), params_ext);
-        weights_stream->open(weights_file, std::ios::binary);
-        // Don't throw error if file isn't opened
-        // It may mean that model don't have constants
+        *weights_file = path;
+        weights_file->replace(weights_file->size() - ext.size(), ext.size(), params_ext);
     } else {
         model_file += paddle::get_path_sep<T>() + "__model__";
     }
@@ -200,16 +240,13 @@ std::basic_string<T> get_model_path(const std::basic_string<T>& path, std::ifstr
 
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
 template <>
-std::basic_string<wchar_t> get_model_path(const std::basic_string<wchar_t>& path, std::ifstream* weights_stream) {
+std::basic_string<wchar_t> get_model_path(const std::basic_string<wchar_t>& path, std::wstring* weights_file) {
     std::wstring model_file{path};
     std::wstring ext = L".pdmodel";
     if (ov::util::ends_with(model_file, ext)) {
         std::wstring params_ext = L".pdiparams";
-        std::wstring weights_file{path};
-        weights_file.replace(weights_file.size() - ext.size(), ext.size(), params_ext);
-        weights_stream->open(weights_file, std::ios::binary);
-        // Don't throw error if file isn't opened
-        // It may mean that model don't have constants
+        *weights_file = path;
+        weights_file->replace(weights_file->size() - ext.size(), ext.size(), params_ext);
     } else {
         model_file += paddle::get_path_sep<wchar_t>() + L"__model__";
     }
@@ -268,7 +305,10 @@ std::vector<std::shared_ptr<OpPlace>> InputModel::InputModelImpl::determine_cut_
 
 template <typename T>
 void InputModel::InputModelImpl::loadConsts(const std::basic_string<T>& folder_with_weights,
-                                            std::istream* weight_stream) {
+                                            std::istream* weight_stream,
+                                            const std::shared_ptr<ov::util::MappedMemory>& weights_mapping) {
+    // the combined parameters are stored one after another in the order of the names
+    size_t weights_offset = 0;
     for (const auto& item : m_var_places) {
         const auto& var_desc = item.second->get_desc();
         const auto& name = item.first;
@@ -282,24 +322,27 @@ void InputModel::InputModelImpl::loadConsts(const std::basic_string<T>& folder_w
         Shape shape(tensor.dims().cbegin(), tensor.dims().cend());
         const auto& type = TYPE_MAP[tensor.data_type()];
         const auto& data_length = shape_size(shape) * type.size();
-        std::vector<uint8_t> tensor_data(data_length);
 
-        bool read_succeed = false;
-        if (weight_stream) {
-            read_succeed = read_tensor(*weight_stream, reinterpret_cast<char*>(&tensor_data[0]), data_length);
+        std::shared_ptr<opset7::Constant> const_node;
+        if (weights_mapping) {
+            const_node = read_mapped_tensor(weights_mapping, weights_offset, type, shape);
+        } else if (weight_stream) {
+            std::vector<uint8_t> tensor_data(data_length);
+            if (read_tensor(*weight_stream, reinterpret_cast<char*>(&tensor_data[0]), data_length))
+                const_node = opset7::Constant::create(type, shape, &tensor_data[0]);
         } else if (!folder_with_weights.empty()) {
-            std::ifstream is(get_const_path(folder_with_weights, name), std::ios::in | std::ifstream::binary);
-            FRONT_END_GENERAL_CHECK(is && is.is_open(), "Cannot open file for constant value.");
-            read_succeed = read_tensor(is, reinterpret_cast<char*>(&tensor_data[0]), data_length);
+            auto mapping = map_weights(get_const_path(folder_with_weights, name));
+            FRONT_END_GENERAL_CHECK(mapping, "Cannot open file for constant value.");
+            size_t offset = 0;
+            const_node = read_mapped_tensor(mapping, offset, type, shape);
         } else {
             FRONT_END_GENERAL_CHECK(false, "Either folder with weights or stream must be provided.");
         }
-        FRONT_END_GENERAL_CHECK(read_succeed,
+        FRONT_END_GENERAL_CHECK(const_node,
                                 "File containing constant with name ",
                                 name,
                                 " wasn't successfully read.");
 
-        auto const_node = opset7::Constant::create(type, shape, &tensor_data[0]);
         const_node->set_friendly_name(name);
         m_tensor_values[name] = const_node;
     }
@@ -313,8 +356,8 @@ InputModel::InputModelImpl::InputModelImpl(const std::basic_string<T>& path,
       m_input_model(input_model),
       m_telemetry(telemetry) {
     std::string empty_str;
-    std::ifstream weights_stream;
-    std::ifstream pb_stream(get_model_path<T>(path, &weights_stream), std::ios::in | std::ifstream::binary);
+    std::basic_string<T> weights_file;
+    std::ifstream pb_stream(get_model_path<T>(path, &weights_file), std::ios::in | std::ifstream::binary);
 
     FRONT_END_GENERAL_CHECK(pb_stream && pb_stream.is_open(), "Model file doesn't exist");
     FRONT_END_GENERAL_CHECK(m_fw_ptr->ParseFromIstream(&pb_stream), "Model can't be parsed");
@@ -327,7 +370,18 @@ InputModel::InputModelImpl::InputModelImpl(const std::basic_string<T>& path,
         version >= 2000000 || version == 0,
         "[Frontend]Only Support Paddle greater than 2.0.0, current version " + std::to_string(version));
     loadPlaces();
-    if (weights_stream && weights_stream.is_open()) {
+    // Don't throw error if the weights file isn't opened
+    // It may mean that model don't have constants
+    std::shared_ptr<ov::util::MappedMemory> weights_mapping;
+    std::ifstream weights_stream;
+    if (!weights_file.empty()) {
+        weights_mapping = map_weights(weights_file);
+        if (!weights_mapping)
+            weights_stream.open(weights_file, std::ios::binary);
+    }
+    if (weights_mapping) {
+        loadConsts(std::basic_string<T>{}, nullptr, weights_mapping);
+    } else if (weights_stream && weights_stream.is_open()) {
         loadConsts(std::basic_string<T>{}, &weights_stream);
     } else {
         loadConsts(path, nullptr);
@@ -274,6 +274,7 @@ static const std::vector<std::string> models{
     std::string("loop_t/loop_t.pdmodel"),
     std::string("loop_tensor_array/loop_tensor_array.pdmodel"),
     std::string("loop_x/loop_x.pdmodel"),
+    std::string("mapped_params/mapped_params.pdmodel"),
     std::string("matmul_xt"),
     std::string("matmul_xt_yt"),
     std::string("matmul_yt"),
@@ -0,0 +1,36 @@
+# Copyright (C) 2018-2022 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+#
+# mapped_params paddle model generator
+#
+import paddle
+import numpy as np
+import sys
+from save_model import saveModel
+
+paddle.enable_static()
+
+# The parameters are saved to the combined file in the order of their names. Each record is a 16 byte header,
+# the 4 byte length of the tensor description and the description itself, followed by the data:
+# - "a_aligned" has 1 dimension, so its data starts at 16 + 4 + 4 = 24 and is aligned for float32,
+#   the constant shares the mapped file;
+# - "b_misaligned" has 2 dimensions and follows the 24 bytes of the first data, so its data starts at
+#   48 + 16 + 4 + 6 = 74 and is not aligned for float32, the constant copies the data.
+data_a = np.arange(6).astype(np.float32)
+data_b = np.arange(6, 12).reshape(2, 3).astype(np.float32)
+inp_blob = np.random.randn(2, 3).astype(np.float32)
+
+x = paddle.static.data(name='x', shape=[2, 3], dtype='float32')
+a = paddle.static.create_parameter(shape=[6], dtype='float32', name='a_aligned',
+                                   default_initializer=paddle.nn.initializer.Assign(data_a))
+b = paddle.static.create_parameter(shape=[2, 3], dtype='float32', name='b_misaligned',
+                                   default_initializer=paddle.nn.initializer.Assign(data_b))
+out = paddle.add(paddle.multiply(x, b), paddle.reshape(a, [2, 3]))
+
+exe = paddle.static.Executor(paddle.CPUPlace())
+exe.run(paddle.static.default_startup_program())
+res_paddle = exe.run(paddle.static.default_main_program(), fetch_list=[out], feed={'x': inp_blob})
+
+saveModel("mapped_params", exe, feedkeys=[x], fetchlist=[out], inputs=[inp_blob], outputs=[res_paddle[0]],
+          target_dir=sys.argv[1], use_static_api=True)
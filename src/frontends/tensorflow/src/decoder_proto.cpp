@@ -8,6 +8,7 @@
 #include "node_def.pb.h"
 #include "openvino/frontend/tensorflow/node_context.hpp"
 #include "openvino/frontend/tensorflow/special_types.hpp"
+#include "openvino/runtime/allocator.hpp"
 #include "types.pb.h"
 
 namespace ov {
@@ -15,6 +16,29 @@ namespace frontend {
 namespace tensorflow {
 
 namespace {
+/// \brief Allocator returning the memory owned by the protobuf message instead of allocating new one
+class ProtoBufferAllocator : public ov::AllocatorImpl {
+public:
+    ProtoBufferAllocator(const std::string& buffer, const std::shared_ptr<::tensorflow::GraphDef>& owner)
+        : m_buffer(buffer),
+          m_owner(owner) {}
+
+    void* allocate(const size_t bytes, const size_t alignment) override {
+        FRONT_END_GENERAL_CHECK(bytes <= m_buffer.size(), "Size of tensor is not equal to tensor_content size.");
+        return const_cast<char*>(m_buffer.data());
+    }
+
+    void deallocate(void* handle, const size_t bytes, size_t alignment) override {}
+
+    bool is_equal(const ov::AllocatorImpl& other) const override {
+        return this == &other;
+    }
+
+private:
+    const std::string& m_buffer;
+    std::shared_ptr<::tensorflow::GraphDef> m_owner;
+};
+
 const std::map<::tensorflow::DataType, ov::element::Type>& TYPE_MAP() {
     static const std::map<::tensorflow::DataType, ov::element::Type> type_map{
         {::tensorflow::DataType::DT_BOOL, ov::element::boolean},
@@ -89,22 +113,22 @@ void extract_compressed_tensor_content(const ::tensorflow::TensorProto& tensor_p
 }  // namespace
 
 ov::Any DecoderProto::get_attribute(const std::string& name) const {
-    auto attrs = decode_attribute_helper(name);
-    if (attrs.empty()) {
+    const auto* attr = decode_attribute_helper(name);
+    if (attr == nullptr) {
         return {};
     }
 
-    switch (attrs[0].value_case()) {
+    switch (attr->value_case()) {
     case ::tensorflow::AttrValue::ValueCase::kB:
-        return attrs[0].b();
+        return attr->b();
     case ::tensorflow::AttrValue::ValueCase::kF:
-        return attrs[0].f();
+        return attr->f();
     case ::tensorflow::AttrValue::ValueCase::kS:
-        return attrs[0].s();
+        return attr->s();
     case ::tensorflow::AttrValue::ValueCase::kI:
-        return attrs[0].i();
+        return attr->i();
     case ::tensorflow::AttrValue::ValueCase::kShape: {
-        const auto& tf_shape = attrs[0].shape();
+        const auto& tf_shape = attr->shape();
         if (tf_shape.unknown_rank()) {
             return ov::PartialShape::dynamic();
         }
@@ -116,8 +140,8 @@ ov::Any DecoderProto::get_attribute(const std::string& name) const {
     }
 
     case ::tensorflow::AttrValue::ValueCase::kType: {
-        if (TYPE_MAP().count(attrs[0].type())) {
-            return TYPE_MAP().at(attrs[0].type());
+        if (TYPE_MAP().count(attr->type())) {
+            return TYPE_MAP().at(attr->type());
         } else {
             // for all unsupported types return undefined type
             return ov::element::undefined;
@@ -125,7 +149,7 @@ ov::Any DecoderProto::get_attribute(const std::string& name) const {
     }
 
     case ::tensorflow::AttrValue::ValueCase::kList: {
-        const auto& list = attrs[0].list();
+        const auto& list = attr->list();
         if (list.i_size())
             return std::vector<int64_t>(list.i().begin(), list.i().end());
 
@@ -169,7 +193,7 @@ ov::Any DecoderProto::get_attribute(const std::string& name) const {
     }
 
     case ::tensorflow::AttrValue::ValueCase::kTensor: {
-        const auto& tensor_proto = attrs[0].tensor();
+        const auto& tensor_proto = attr->tensor();
         const auto& tf_shape = tensor_proto.tensor_shape();
         ov::PartialShape pshape;
         for (int i = 0; i < tf_shape.dim_size(); i++) {
@@ -181,8 +205,16 @@ ov::Any DecoderProto::get_attribute(const std::string& name) const {
             TYPE_MAP().count(tf_type),
             "Encountered unknown element type " + DataType_Name(tf_type) + " on an empty tensor_proto");
         auto ov_type = TYPE_MAP().at(tf_type);
+        const auto& tensor_content = tensor_proto.tensor_content();
+        if (m_graph_def && !tensor_content.empty() && tensor_proto.has_tensor_shape() &&
+            tensor_content.size() == shape_size(pshape.get_shape()) * ov_type.size() &&
+            reinterpret_cast<uintptr_t>(tensor_content.data()) % ov_type.size() == 0) {
+            // Suitably aligned tensor content is shared with the resulting tensor instead of copying
+            return ov::Tensor(ov_type,
+                              pshape.get_shape(),
+                              ov::Allocator(std::make_shared<ProtoBufferAllocator>(tensor_content, m_graph_def)));
+        }
         ov::Tensor res(ov_type, pshape.get_shape());
-        auto tensor_content = tensor_proto.tensor_content();
         if (!tensor_content.empty() && tensor_proto.has_tensor_shape()) {
             switch (ov_type) {
             case ov::element::u8:
@@ -294,14 +326,11 @@ const std::string& DecoderProto::get_op_name() const {
     return m_node_def->name();
 }
 
-std::vector<::tensorflow::AttrValue> DecoderProto::decode_attribute_helper(const std::string& name) const {
-    auto attr_map = m_node_def->attr();
-    if (attr_map.contains(name)) {
-        auto value = m_node_def->attr().at(name);
-        return {value};
-    } else {
-        return {};
-    }
+const ::tensorflow::AttrValue* DecoderProto::decode_attribute_helper(const std::string& name) const {
+    // the attribute is returned by pointer, so large tensor attributes are not copied
+    const auto& attr_map = m_node_def->attr();
+    const auto it = attr_map.find(name);
+    return it != attr_map.end() ? &it->second : nullptr;
 }
 }  // namespace tensorflow
 }  // namespace frontend
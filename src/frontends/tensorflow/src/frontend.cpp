@@ -426,6 +426,9 @@ void FrontEnd::convert(const std::shared_ptr<ov::Model>& partiallyConverted) con
 
 void FrontEnd::normalize(const std::shared_ptr<ov::Model>& function) const {
     ov::pass::Manager manager;
+    // the passes below only replace nodes and their inputs, which is tracked by the nodes,
+    // so only the changed parts of the model are revalidated after each pass
+    manager.set_incremental_validation(true);
 
     // Runs middle transformations to convert sub-graphs with intermediate (frontend internal) operations
     // into sub-graphs with only OpenVINO operations
@@ -4,8 +4,10 @@
 
 #pragma once
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
 #include <exception>
-#include <future>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -39,8 +41,6 @@ namespace InferenceEngine {
  */
 class AsyncInferRequestThreadSafeDefault : public IInferRequestInternal {
     enum InferState { Idle, Busy, Cancelled, Stop };
-    using Futures = std::vector<std::shared_future<void>>;
-    using Promise = std::shared_ptr<std::promise<void>>;
     enum Stage_e : std::uint8_t { executor, task };
     IInferRequestInternal::Ptr _syncRequest;
 
@@ -48,14 +48,14 @@ class AsyncInferRequestThreadSafeDefault : public IInferRequestInternal {
     struct DisableCallbackGuard {
         explicit DisableCallbackGuard(AsyncInferRequestThreadSafeDefault* this_) : _this{this_} {
             std::lock_guard<std::mutex> lock{_this->_mutex};
-            std::swap(_callback, _this->_callback);
+            std::swap(_callback, _this->_sharedCallback);
         }
         ~DisableCallbackGuard() {
             std::lock_guard<std::mutex> lock{_this->_mutex};
-            _this->_callback = _callback;
+            _this->_sharedCallback = _callback;
         }
         AsyncInferRequestThreadSafeDefault* _this = nullptr;
-        Callback _callback;
+        std::shared_ptr<Callback> _callback;
     };
 
     struct ImmediateStreamsExecutor : public InferenceEngine::ITaskExecutor {
@@ -80,19 +80,8 @@ class AsyncInferRequestThreadSafeDefault : public IInferRequestInternal {
             case InferState::Cancelled:
                 IE_THROW(InferCancelled);
             case InferState::Idle: {
-                _futures.erase(std::remove_if(std::begin(_futures),
-                                              std::end(_futures),
-                                              [](const std::shared_future<void>& future) {
-                                                  if (future.valid()) {
-                                                      return (std::future_status::ready ==
-                                                              future.wait_for(std::chrono::milliseconds{0}));
-                                                  } else {
-                                                      return true;
-                                                  }
-                                              }),
-                               _futures.end());
-                _promise = {};
-                _futures.emplace_back(_promise.get_future().share());
+                _currentRun = ++_startedRuns;
+                _activeRuns.push_back(_currentRun);
             } break;
             case InferState::Stop:
                 break;
@@ -103,8 +92,8 @@ class AsyncInferRequestThreadSafeDefault : public IInferRequestInternal {
             try {
                 f();
             } catch (...) {
-                _promise.set_exception(std::current_exception());
                 std::lock_guard<std::mutex> lock{_mutex};
+                FinishRun(_currentRun, std::current_exception());
                 _state = InferState::Idle;
                 throw;
             }
@@ -162,6 +151,8 @@ public:
                                   _syncRequest->InferImpl();
                               }}};
         }
+        // a started run may overlap only with the callback of the previous one
+        _activeRuns.reserve(2);
     }
 
     /**
@@ -182,33 +173,33 @@ public:
             IE_THROW(ParameterMismatch) << " Timeout can't be less " << InferRequest::WaitMode::RESULT_READY
                                         << " for InferRequest::Wait\n";
         }
-        auto status = std::future_status::deferred;
+        std::unique_lock<std::mutex> lock{_mutex};
 
-        // Just use the last '_futures' member to wait pipeline completion
-        auto future = [&] {
-            std::lock_guard<std::mutex> lock{_mutex};
-            return _futures.empty() ? std::shared_future<void>{} : _futures.back();
-        }();
-
-        if (!future.valid()) {
+        // Just use the last started run to wait pipeline completion
+        const auto run = _startedRuns;
+        if (run == 0) {
             return StatusCode::INFER_NOT_STARTED;
         }
 
+        auto isFinished = [&] {
+            return std::find(_activeRuns.begin(), _activeRuns.end(), run) == _activeRuns.end();
+        };
+
         switch (millis_timeout) {
         case InferRequest::WaitMode::RESULT_READY: {
-            future.wait();
-            status = std::future_status::ready;
+            _runFinished.wait(lock, isFinished);
         } break;
         case InferRequest::WaitMode::STATUS_ONLY: {
-            status = future.wait_for(std::chrono::milliseconds{0});
         } break;
         default: {
-            status = future.wait_for(std::chrono::milliseconds{millis_timeout});
+            _runFinished.wait_for(lock, std::chrono::milliseconds{millis_timeout}, isFinished);
         } break;
         }
 
-        if (std::future_status::ready == status) {
-            future.get();
+        if (isFinished()) {
+            if (run == _exceptionRun && nullptr != _exception) {
+                std::rethrow_exception(_exception);
+            }
             return StatusCode::OK;
         } else {
             return StatusCode::RESULT_NOT_READY;
@@ -270,7 +261,9 @@ public:
 
     void SetCallback(Callback callback) override {
         CheckState();
-        _callback = std::move(callback);
+        auto sharedCallback = callback ? std::make_shared<Callback>(std::move(callback)) : nullptr;
+        std::lock_guard<std::mutex> lock{_mutex};
+        _sharedCallback = std::move(sharedCallback);
     }
 
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> QueryState() override {
@@ -310,9 +303,10 @@ protected:
     using Pipeline = std::vector<Stage>;
 
     /**
-     * @brief Creates and run the first stage task. If destructor was not called add a new std::future to the
-     * AsyncInferRequestThreadSafeDefault::_futures list that would be used to wait
-     * AsyncInferRequestThreadSafeDefault::_pipeline finish
+     * @brief Creates and runs the first stage task.
+     * Before this call the run is numbered by incrementing AsyncInferRequestThreadSafeDefault::_startedRuns and is
+     * added to AsyncInferRequestThreadSafeDefault::_activeRuns. The last stage removes it from there, so Wait() and
+     * StopAndWait() wait for AsyncInferRequestThreadSafeDefault::_pipeline finish
      * @param[in]  itBeginStage Iterator to begin of pipeline
      * @param[in]  itEndStage End pipeline iterator
      * @param[in]  callbackExecutor Final or error stage executor
@@ -322,7 +316,10 @@ protected:
                        const ITaskExecutor::Ptr callbackExecutor = {}) {
         auto& firstStageExecutor = std::get<Stage_e::executor>(*itBeginStage);
         IE_ASSERT(nullptr != firstStageExecutor);
-        firstStageExecutor->run(MakeNextStageTask(itBeginStage, itEndStage, std::move(callbackExecutor)));
+        // Only one pipeline run is active at a time, so its parameters are kept in the request itself
+        _itEndStage = itEndStage;
+        _stageCallbackExecutor = std::move(callbackExecutor);
+        firstStageExecutor->run(MakeNextStageTask(itBeginStage));
     }
 
     /**
@@ -331,23 +328,13 @@ protected:
      * pipeline tasks
      */
     void StopAndWait() {
-        Futures futures;
-        InferState state = InferState::Idle;
-        {
-            std::lock_guard<std::mutex> lock{_mutex};
-            state = _state;
-            if (state != InferState::Stop) {
-                _callback = {};
-                _state = InferState::Stop;
-                futures = std::move(_futures);
-            }
-        }
-        if (state != InferState::Stop) {
-            for (auto&& future : futures) {
-                if (future.valid()) {
-                    future.wait();
-                }
-            }
+        std::unique_lock<std::mutex> lock{_mutex};
+        if (_state != InferState::Stop) {
+            _sharedCallback = {};
+            _state = InferState::Stop;
+            _runFinished.wait(lock, [this] {
+                return _activeRuns.empty();
+            });
         }
     }
 
@@ -383,78 +370,107 @@ protected:
 private:
     /**
      * @brief Create a task with next pipeline stage.
-     * Each call to MakeNextStageTask() generates @ref Task objects for each stage.
-     * On last stage or if the exception is raised from `_pipeline` task
-     * the last stage task is called or passed to callback executor if it is presented. The last stage task call the
-     * callback, if it is presented, capture the `_promise` member and use it to forward completion or exception to the
-     * one of `_futures` member
+     * The task captures only the request pointer and the stage iterator, so it fits the small object buffer of
+     * @ref Task and starting of a stage does not allocate memory.
      * @param[in]  itStage Iterator to next stage of pipeline
-     * @param[in]  itEndStage End pipeline iterator
-     * @param[in]  callbackExecutor Executor that will run final stage with callback call
      * @return A next stage task
      */
-    Task MakeNextStageTask(const Pipeline::iterator itStage,
-                           const Pipeline::iterator itEndStage,
-                           const ITaskExecutor::Ptr callbackExecutor) {
-        return std::bind(
-            [this, itStage, itEndStage](ITaskExecutor::Ptr& callbackExecutor) mutable {
-                std::exception_ptr currentException = nullptr;
-                auto& thisStage = *itStage;
-                auto itNextStage = itStage + 1;
-                try {
-                    auto& stageTask = std::get<Stage_e::task>(thisStage);
-                    IE_ASSERT(nullptr != stageTask);
-                    stageTask();
-                    if (itEndStage != itNextStage) {
-                        auto& nextStage = *itNextStage;
-                        auto& nextStageExecutor = std::get<Stage_e::executor>(nextStage);
-                        IE_ASSERT(nullptr != nextStageExecutor);
-                        nextStageExecutor->run(MakeNextStageTask(itNextStage, itEndStage, std::move(callbackExecutor)));
-                    }
-                } catch (...) {
-                    currentException = std::current_exception();
-                }
-
-                if ((itEndStage == itNextStage) || (nullptr != currentException)) {
-                    auto lastStageTask = [this, currentException]() mutable {
-                        auto promise = std::move(_promise);
-                        Callback callback;
-                        {
-                            std::lock_guard<std::mutex> lock{_mutex};
-                            _state = InferState::Idle;
-                            std::swap(callback, _callback);
-                        }
-                        if (callback) {
-                            try {
-                                callback(currentException);
-                            } catch (...) {
-                                currentException = std::current_exception();
-                            }
-                            std::lock_guard<std::mutex> lock{_mutex};
-                            if (!_callback) {
-                                std::swap(callback, _callback);
-                            }
-                        }
-                        if (nullptr == currentException) {
-                            promise.set_value();
-                        } else {
-                            promise.set_exception(currentException);
-                        }
-                    };
-
-                    if (nullptr == callbackExecutor) {
-                        lastStageTask();
-                    } else {
-                        callbackExecutor->run(std::move(lastStageTask));
-                    }
-                }
-            },
-            std::move(callbackExecutor));
+    Task MakeNextStageTask(const Pipeline::iterator itStage) {
+        return [this, itStage] {
+            RunStage(itStage);
+        };
+    }
+
+    /**
+     * @brief Runs a pipeline stage and schedules the next one.
+     * On last stage or if the exception is raised from `_pipeline` task
+     * the last stage task is called or passed to callback executor if it is presented.
+     * @param[in]  itStage Iterator to the stage of pipeline
+     */
+    void RunStage(const Pipeline::iterator itStage) {
+        std::exception_ptr currentException = nullptr;
+        auto itNextStage = itStage + 1;
+        // must be evaluated before the next stage is scheduled, as it may finish and restart the pipeline
+        const bool isLastStage = _itEndStage == itNextStage;
+        try {
+            auto& stageTask = std::get<Stage_e::task>(*itStage);
+            IE_ASSERT(nullptr != stageTask);
+            stageTask();
+            if (!isLastStage) {
+                auto& nextStageExecutor = std::get<Stage_e::executor>(*itNextStage);
+                IE_ASSERT(nullptr != nextStageExecutor);
+                nextStageExecutor->run(MakeNextStageTask(itNextStage));
+            }
+        } catch (...) {
+            currentException = std::current_exception();
+        }
+
+        if (isLastStage || (nullptr != currentException)) {
+            _stageException = std::move(currentException);
+            if (nullptr == _stageCallbackExecutor) {
+                RunLastStage();
+            } else {
+                _stageCallbackExecutor->run([this] {
+                    RunLastStage();
+                });
+            }
+        }
+    }
+
+    /**
+     * @brief The last stage task calls the callback, if it is presented, and forwards completion or exception
+     * of the pipeline run to the waiters
+     * @note The callback stays set while it is called, so a run started from the callback, or by a thread woken up
+     * by it, calls the callback as well
+     */
+    void RunLastStage() {
+        auto currentException = std::move(_stageException);
+        const auto run = _currentRun;
+        std::shared_ptr<Callback> callback;
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            _state = InferState::Idle;
+            callback = _sharedCallback;
+        }
+        if (callback) {
+            try {
+                (*callback)(currentException);
+            } catch (...) {
+                currentException = std::current_exception();
+            }
+        }
+        std::lock_guard<std::mutex> lock{_mutex};
+        FinishRun(run, currentException);
+    }
+
+    /**
+     * @brief Marks the pipeline run as finished and wakes up the waiters
+     * @note Should be called under the `_mutex` lock
+     */
+    void FinishRun(const std::size_t run, const std::exception_ptr& exception) {
+        auto itRun = std::find(_activeRuns.begin(), _activeRuns.end(), run);
+        if (itRun != _activeRuns.end()) {
+            _activeRuns.erase(itRun);
+        }
+        if (nullptr != exception) {
+            _exception = exception;
+            _exceptionRun = run;
+        }
+        _runFinished.notify_all();
     }
 
-    std::promise<void> _promise;
     mutable std::mutex _mutex;
-    Futures _futures;
+    std::condition_variable _runFinished;
+    std::size_t _startedRuns = 0;           //!< Number of started pipeline runs, identifies the last one
+    std::size_t _currentRun = 0;            //!< The pipeline run executed now
+    std::vector<std::size_t> _activeRuns;   //!< Pipeline runs which are not finished yet
+    std::exception_ptr _exception;          //!< Exception of the last failed pipeline run
+    std::size_t _exceptionRun = 0;          //!< The last failed pipeline run
+    Pipeline::iterator _itEndStage{};       //!< End iterator of the running pipeline
+    ITaskExecutor::Ptr _stageCallbackExecutor;  //!< Executor of the last stage of the running pipeline
+    std::exception_ptr _stageException;     //!< Exception passed to the last stage of the running pipeline
     InferState _state = InferState::Idle;
+    // The callback is shared with the running last stage, so it is not copied on every run
+    std::shared_ptr<Callback> _sharedCallback;
 };
 }  // namespace InferenceEngine
@@ -92,6 +92,20 @@ DECLARE_CONFIG_KEY(SMALL_CORE_OFFSET);
  */
 DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_CAPACITY);
 
+/**
+ * @brief Defines whether the CPU nodes with a small estimated work size are executed on a reduced number of threads
+ * (YES) or always on all the stream threads (NO, default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_WORK_SIZE_AWARE_THREADING);
+
+/**
+ * @brief Defines whether the CPU graph revisits the layouts of the element-wise nodes to reduce the number of
+ * inserted reorders (YES) or keeps the layouts selected node by node (NO, default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_LAYOUT_OPTIMIZATION);
+
 /**
  * @brief This key should be used to force disable export while loading network even if global cache dir is defined
  *        Used by HETERO plugin to disable automatic caching of subnetworks (set value to YES)
@@ -108,6 +122,13 @@ DECLARE_CONFIG_KEY(CONFIG_DEVICE_ID);
  * @brief enable hyper thread
  */
 DECLARE_CONFIG_KEY(ENABLE_HYPER_THREAD);
+
+/**
+ * @brief Defines whether the `ie_parallel` calls of the streams are executed on a spin-wait thread pool (YES)
+ * instead of the threading library (NO, default). It reduces the threads wake-up latency of small models.
+ * Is supported with the TBB threading only.
+ */
+DECLARE_CONFIG_KEY(CPU_SPIN_THREAD_POOL);
 }  // namespace PluginConfigInternalParams
 
 }  // namespace InferenceEngine
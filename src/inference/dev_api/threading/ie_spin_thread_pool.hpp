@@ -0,0 +1,69 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @file ie_spin_thread_pool.hpp
+ * @brief A header file for Inference Engine spin-wait thread pool implementation
+ */
+
+#pragma once
+
+#include <functional>
+#include <memory>
+
+#include "ie_parallel.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @class SpinThreadPool
+ * @ingroup ie_dev_api_threading
+ * @brief A fixed size thread pool for the `ie_parallel` calls of small, latency bound workloads.
+ *        The thread the pool is set for (see parallel_set_pool()) executes the chunk 0 itself, the other chunks
+ *        are statically assigned to the pool worker threads. The idle workers spin for a bounded time waiting
+ *        for the next call and park on a condition variable after that, so short sequences of parallel regions
+ *        do not pay for the thread wake-ups. Nested calls are executed sequentially by the calling thread.
+ */
+class INFERENCE_ENGINE_API_CLASS(SpinThreadPool) : public IParallelPool {
+public:
+    /**
+     * @brief A shared pointer to a SpinThreadPool object
+     */
+    using Ptr = std::shared_ptr<SpinThreadPool>;
+
+    /**
+     * @brief Constructor
+     * @param threads The number of threads including the thread the pool is set for, so `threads - 1`
+     *        worker threads are created
+     * @param onWorkerStart The function called by each worker thread with its index in the pool before
+     *        processing any work, e.g. to pin the thread
+     */
+    explicit SpinThreadPool(int threads, std::function<void(int)> onWorkerStart = {});
+
+    /**
+     * @brief Stops and joins the worker threads
+     */
+    ~SpinThreadPool() override;
+
+    int get_threads() const override;
+
+    int get_thread_num() const override;
+
+    void run(int nthr, const std::function<void(int, int)>& func) override;
+
+    /**
+     * @brief Notifies the pool that a thread of the threading library started (`active` is true) or finished
+     *        working on the cores of the pool, e.g. a oneDNN primitive is executed in the stream arena.
+     *        While there are such threads the idle workers park instead of spinning, so they do not compete
+     *        with the threading library for the cores.
+     * @param active Whether the thread started or finished working
+     */
+    void set_external_thread_active(bool active);
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+
+}  // namespace InferenceEngine
@@ -40,5 +40,16 @@ namespace CPUConfigParams {
  */
 DECLARE_CPU_CONFIG_KEY(DENORMALS_OPTIMIZATION);
 
+/**
+ * @brief The name for defining the minimal sparse rate of FullyConnected weights
+ *
+ * If the share of the constant weights of a FullyConnected layer skipped by the block-compressed sparse format
+ * (input channels equal to zero in a whole block of output channels) is greater or equal to the value of this
+ * option, CPU plugin stores the weights in this format and executes the layer with the dedicated sparse kernel.
+ * It is passed to Core::SetConfig(), this option should be used with floating point values in range [0, 1].
+ * The default value is 1, which means the sparse weights decompression is disabled.
+ */
+DECLARE_CPU_CONFIG_KEY(SPARSE_WEIGHTS_DECOMPRESSION_RATE);
+
 }  // namespace CPUConfigParams
 }  // namespace InferenceEngine
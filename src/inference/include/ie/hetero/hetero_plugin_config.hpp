@@ -34,5 +34,12 @@ namespace HeteroConfigParams {
  */
 DECLARE_HETERO_CONFIG_KEY(DUMP_GRAPH_DOT);
 
+/**
+ * @brief The key for enabling of the partitioning which moves layers supported by several devices to minimize
+ * the size of intermediate tensors transferred between devices. Layers affinities set by a user are not changed.
+ * This option should be used with values: CONFIG_VALUE(NO) (default) or CONFIG_VALUE(YES)
+ */
+DECLARE_HETERO_CONFIG_KEY(MINIMIZE_TRANSFERS);
+
 }  // namespace HeteroConfigParams
 }  // namespace InferenceEngine
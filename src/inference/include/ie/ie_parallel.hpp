@@ -14,14 +14,77 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
+#include <functional>
 #include <type_traits>
 
+#include "ie_api.h"
+
 #define IE_THREAD_TBB      0
 #define IE_THREAD_OMP      1
 #define IE_THREAD_SEQ      2
 #define IE_THREAD_TBB_AUTO 3
 
+namespace InferenceEngine {
+
+/**
+ * @interface IParallelPool
+ * @brief A thread pool the parallel helpers dispatch the work to instead of the threading library.
+ * It is set per thread with parallel_set_pool(), so it can be chosen at runtime, e.g. per executor stream.
+ */
+class IParallelPool {
+public:
+    virtual ~IParallelPool() = default;
+
+    /**
+     * @brief Returns the number of the pool threads including the thread the pool is set for
+     * @return The number of threads
+     */
+    virtual int get_threads() const = 0;
+
+    /**
+     * @brief Returns the index of the calling thread in the pool, 0 for the thread the pool is set for
+     * @return The thread index
+     */
+    virtual int get_thread_num() const = 0;
+
+    /**
+     * @brief Calls func(ithr, nthr) for each ithr in [0, nthr) on the pool threads and waits for all of them.
+     * The chunk ithr is executed by the pool thread `ithr % min(nthr, get_threads())`.
+     * @param nthr The number of work chunks
+     * @param func The function to call
+     */
+    virtual void run(int nthr, const std::function<void(int, int)>& func) = 0;
+};
+
+namespace details {
+// The pool thread executing the current chunk: its index and the pool threads number, or -1 and 0 outside the chunks.
+// It is kept by the parallel helpers themselves, so the thread queries do not call into the pool.
+struct parallel_pool_thread_info {
+    int num;
+    int threads;
+};
+inline parallel_pool_thread_info& parallel_pool_thread() {
+    static thread_local parallel_pool_thread_info info{-1, 0};
+    return info;
+}
+}  // namespace details
+
+/**
+ * @brief Returns the parallel pool set for the current thread
+ * @return The pool or nullptr if the threading library is used
+ */
+INFERENCE_ENGINE_API_CPP(IParallelPool*) parallel_get_pool();
+
+/**
+ * @brief Sets the parallel pool for the current thread
+ * @param pool The pool or nullptr to use the threading library
+ */
+INFERENCE_ENGINE_API_CPP(void) parallel_set_pool(IParallelPool* pool);
+
+}  // namespace InferenceEngine
+
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
 #    ifndef NOMINMAX
 #        define NOMINMAX
@@ -49,12 +112,18 @@
 #    include "tbb/task_scheduler_observer.h"
 
 inline int parallel_get_max_threads() {
+    const int poolThreads = InferenceEngine::details::parallel_pool_thread().threads;
+    if (poolThreads > 0)
+        return poolThreads;
     return tbb::this_task_arena::max_concurrency();
 }
 inline int parallel_get_num_threads() {
     return parallel_get_max_threads();
 }
 inline int parallel_get_thread_num() {
+    const int poolThreadNum = InferenceEngine::details::parallel_pool_thread().num;
+    if (poolThreadNum >= 0)
+        return poolThreadNum;
     return tbb::this_task_arena::current_thread_index();
 }
 inline void parallel_set_num_threads(int) {
@@ -89,12 +158,18 @@ inline int parallel_get_env_threads() {
 #        define collapse(x)
 #    endif  // defined(_MSC_VER) && !defined(__INTEL_COMPILER)
 inline int parallel_get_max_threads() {
+    const int poolThreads = InferenceEngine::details::parallel_pool_thread().threads;
+    if (poolThreads > 0)
+        return poolThreads;
     return omp_get_max_threads();
 }
 inline int parallel_get_num_threads() {
     return omp_get_num_threads();
 }
 inline int parallel_get_thread_num() {
+    const int poolThreadNum = InferenceEngine::details::parallel_pool_thread().num;
+    if (poolThreadNum >= 0)
+        return poolThreadNum;
     return omp_get_thread_num();
 }
 inline void parallel_set_num_threads(int n) {
@@ -133,11 +208,101 @@ inline void parallel_set_num_threads(int) {
 
 namespace InferenceEngine {
 
+namespace details {
+inline int& parallel_threads_limit() {
+    static thread_local int limit = 0;
+    return limit;
+}
+}  // namespace details
+
+/**
+ * @brief Returns the number of threads the parallel_for* and parallel_nt(0, ...) helpers split the work into
+ * when called from the current thread. It is the max threads number reduced by the ParallelThreadsLimit set
+ * on this thread, if any.
+ * @return The number of threads
+ */
+inline int parallel_get_work_threads() {
+    const int nthr = parallel_get_max_threads();
+    const int limit = details::parallel_threads_limit();
+    return (limit > 0 && limit < nthr) ? limit : nthr;
+}
+
+/**
+ * @brief Limits the number of threads used by the parallel helpers called from the current thread
+ * while the object is alive. Zero or a negative limit means no limit.
+ * Small workloads use it to avoid waking up the whole arena for a few hundred elements.
+ */
+class ParallelThreadsLimit {
+public:
+    explicit ParallelThreadsLimit(int limit) : prevLimit(details::parallel_threads_limit()) {
+        details::parallel_threads_limit() = limit;
+    }
+    ~ParallelThreadsLimit() {
+        details::parallel_threads_limit() = prevLimit;
+    }
+    ParallelThreadsLimit(const ParallelThreadsLimit&) = delete;
+    ParallelThreadsLimit& operator=(const ParallelThreadsLimit&) = delete;
+
+private:
+    int prevLimit;
+};
+
+namespace details {
+template <typename F>
+void parallel_run_on_pool(IParallelPool* pool, int nthr, const F& func) {
+    if (nthr == 1) {
+        func(0, 1);
+        return;
+    }
+    const int threads = pool->get_threads();
+    const int active = std::min(nthr, threads);
+    pool->run(nthr, [&](int ithr, int chunks) {
+        auto& current = parallel_pool_thread();
+        // the nested calls are executed sequentially by the thread of the outer chunk
+        if (current.num >= 0) {
+            func(ithr, chunks);
+            return;
+        }
+        struct ThreadInfoGuard {
+            parallel_pool_thread_info& info;
+            ~ThreadInfoGuard() {
+                info = {-1, 0};
+            }
+        } guard{current};
+        current = {ithr % active, threads};
+        func(ithr, chunks);
+    });
+}
+
+// Runs func(ithr, nthr) on the parallel pool of the current thread, returns false if there is no pool
+template <typename F>
+bool parallel_run_on_pool(int nthr, const F& func) {
+    auto pool = parallel_get_pool();
+    if (pool == nullptr)
+        return false;
+    parallel_run_on_pool(pool, nthr == 0 ? parallel_get_work_threads() : nthr, func);
+    return true;
+}
+
+// Same as above, but the work is not split into more chunks than work items
+template <typename F>
+bool parallel_for_on_pool(size_t work_amount, const F& func) {
+    auto pool = parallel_get_pool();
+    if (pool == nullptr)
+        return false;
+    const auto nthr = static_cast<size_t>(parallel_get_work_threads());
+    parallel_run_on_pool(pool, static_cast<int>(std::max<size_t>(std::min(work_amount, nthr), 1)), func);
+    return true;
+}
+}  // namespace details
+
 template <typename F>
 void parallel_nt(int nthr, const F& func) {
+    if (details::parallel_run_on_pool(nthr, func))
+        return;
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
     if (nthr == 0)
-        nthr = parallel_get_max_threads();
+        nthr = parallel_get_work_threads();
     if (nthr == 1) {
         func(0, 1);
         return;
@@ -147,6 +312,8 @@ void parallel_nt(int nthr, const F& func) {
         func(ithr, nthr);
     });
 #elif IE_THREAD == IE_THREAD_OMP
+    if (nthr == 0)
+        nthr = parallel_get_work_threads();
     if (nthr == 1) {
         func(0, 1);
         return;
@@ -161,19 +328,21 @@ void parallel_nt(int nthr, const F& func) {
 
 template <typename F>
 void parallel_nt_static(int nthr, const F& func) {
+    if (details::parallel_run_on_pool(nthr, func))
+        return;
 #if IE_THREAD == IE_THREAD_SEQ
     const bool serial = true;
 #else
     const bool serial = false;
 #endif
 
+    if (nthr == 0)
+        nthr = parallel_get_work_threads();
     if (serial || nthr == 1) {
         func(0, 1);
         return;
     }
 
-    if (nthr == 0)
-        nthr = parallel_get_max_threads();
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
     tbb::parallel_for(
         0,
@@ -408,9 +577,13 @@ void for_1d(const int& ithr, const int& nthr, const T0& D0, const F& func) {
 
 template <typename T0, typename F>
 void parallel_for(const T0& D0, const F& func) {
+    if (details::parallel_for_on_pool(static_cast<size_t>(D0), [&](int ithr, int nthr) {
+            for_1d(ithr, nthr, D0, func);
+        }))
+        return;
 #if IE_THREAD == IE_THREAD_TBB
     auto work_amount = static_cast<size_t>(D0);
-    int nthr = parallel_get_max_threads();
+    int nthr = parallel_get_work_threads();
     if (static_cast<size_t>(nthr) > work_amount)
         nthr = static_cast<int>(work_amount);
     if (nthr == 1) {
@@ -425,12 +598,12 @@ void parallel_for(const T0& D0, const F& func) {
             tbb::static_partitioner());
     }
 #elif IE_THREAD == IE_THREAD_TBB_AUTO
-    const int nthr = parallel_get_max_threads();
+    const int nthr = parallel_get_work_threads();
     tbb::parallel_for(0, nthr, [&](int ithr) {
         for_1d(ithr, nthr, D0, func);
     });
 #elif IE_THREAD == IE_THREAD_OMP
-#    pragma omp parallel
+#    pragma omp parallel num_threads(parallel_get_work_threads())
     for_1d(parallel_get_thread_num(), parallel_get_num_threads(), D0, func);
 #elif IE_THREAD == IE_THREAD_SEQ
     for_1d(0, 1, D0, func);
@@ -456,9 +629,13 @@ void for_2d(const int& ithr, const int& nthr, const T0& D0, const T1& D1, const
 
 template <typename T0, typename T1, typename F>
 void parallel_for2d(const T0& D0, const T1& D1, const F& func) {
+    if (details::parallel_for_on_pool(static_cast<size_t>(D0 * D1), [&](int ithr, int nthr) {
+            for_2d(ithr, nthr, D0, D1, func);
+        }))
+        return;
 #if IE_THREAD == IE_THREAD_TBB
     auto work_amount = static_cast<size_t>(D0 * D1);
-    int nthr = parallel_get_max_threads();
+    int nthr = parallel_get_work_threads();
     if (static_cast<size_t>(nthr) > work_amount)
         nthr = static_cast<int>(work_amount);
     if (nthr == 1) {
@@ -473,12 +650,12 @@ void parallel_for2d(const T0& D0, const T1& D1, const F& func) {
             tbb::static_partitioner());
     }
 #elif IE_THREAD == IE_THREAD_TBB_AUTO
-    const int nthr = parallel_get_max_threads();
+    const int nthr = parallel_get_work_threads();
     tbb::parallel_for(0, nthr, [&](int ithr) {
         for_2d(ithr, nthr, D0, D1, func);
     });
 #elif IE_THREAD == IE_THREAD_OMP
-#    pragma omp parallel
+#    pragma omp parallel num_threads(parallel_get_work_threads())
     for_2d(parallel_get_thread_num(), parallel_get_num_threads(), D0, D1, func);
 #elif IE_THREAD == IE_THREAD_SEQ
     for_2d(0, 1, D0, D1, func);
@@ -505,9 +682,13 @@ void for_3d(const int& ithr, const int& nthr, const T0& D0, const T1& D1, const
 
 template <typename T0, typename T1, typename T2, typename F>
 void parallel_for3d(const T0& D0, const T1& D1, const T2& D2, const F& func) {
+    if (details::parallel_for_on_pool(static_cast<size_t>(D0 * D1 * D2), [&](int ithr, int nthr) {
+            for_3d(ithr, nthr, D0, D1, D2, func);
+        }))
+        return;
 #if IE_THREAD == IE_THREAD_TBB
     auto work_amount = static_cast<size_t>(D0 * D1 * D2);
-    int nthr = parallel_get_max_threads();
+    int nthr = parallel_get_work_threads();
     if (static_cast<size_t>(nthr) > work_amount)
         nthr = static_cast<int>(work_amount);
     if (nthr == 1) {
@@ -522,12 +703,12 @@ void parallel_for3d(const T0& D0, const T1& D1, const T2& D2, const F& func) {
             tbb::static_partitioner());
     }
 #elif IE_THREAD == IE_THREAD_TBB_AUTO
-    const int nthr = parallel_get_max_threads();
+    const int nthr = parallel_get_work_threads();
     tbb::parallel_for(0, nthr, [&](int ithr) {
         for_3d(ithr, nthr, D0, D1, D2, func);
     });
 #elif IE_THREAD == IE_THREAD_OMP
-#    pragma omp parallel
+#    pragma omp parallel num_threads(parallel_get_work_threads())
     for_3d(parallel_get_thread_num(), parallel_get_num_threads(), D0, D1, D2, func);
 #elif IE_THREAD == IE_THREAD_SEQ
     for_3d(0, 1, D0, D1, D2, func);
@@ -555,9 +736,13 @@ void for_4d(const int& ithr, const int& nthr, const T0& D0, const T1& D1, const
 
 template <typename T0, typename T1, typename T2, typename T3, typename F>
 void parallel_for4d(const T0& D0, const T1& D1, const T2& D2, const T3& D3, const F& func) {
+    if (details::parallel_for_on_pool(static_cast<size_t>(D0 * D1 * D2 * D3), [&](int ithr, int nthr) {
+            for_4d(ithr, nthr, D0, D1, D2, D3, func);
+        }))
+        return;
 #if IE_THREAD == IE_THREAD_TBB
     auto work_amount = static_cast<size_t>(D0 * D1 * D2 * D3);
-    int nthr = parallel_get_max_threads();
+    int nthr = parallel_get_work_threads();
     if (static_cast<size_t>(nthr) > work_amount)
         nthr = static_cast<int>(work_amount);
     if (nthr == 1) {
@@ -572,12 +757,12 @@ void parallel_for4d(const T0& D0, const T1& D1, const T2& D2, const T3& D3, cons
             tbb::static_partitioner());
     }
 #elif IE_THREAD == IE_THREAD_TBB_AUTO
-    const int nthr = parallel_get_max_threads();
+    const int nthr = parallel_get_work_threads();
     tbb::parallel_for(0, nthr, [&](int ithr) {
         for_4d(ithr, nthr, D0, D1, D2, D3, func);
     });
 #elif IE_THREAD == IE_THREAD_OMP
-#    pragma omp parallel
+#    pragma omp parallel num_threads(parallel_get_work_threads())
     for_4d(parallel_get_thread_num(), parallel_get_num_threads(), D0, D1, D2, D3, func);
 #elif IE_THREAD == IE_THREAD_SEQ
     for_4d(0, 1, D0, D1, D2, D3, func);
@@ -613,9 +798,13 @@ void for_5d(const int& ithr,
 
 template <typename T0, typename T1, typename T2, typename T3, typename T4, typename F>
 void parallel_for5d(const T0& D0, const T1& D1, const T2& D2, const T3& D3, const T4& D4, const F& func) {
+    if (details::parallel_for_on_pool(static_cast<size_t>(D0 * D1 * D2 * D3 * D4), [&](int ithr, int nthr) {
+            for_5d(ithr, nthr, D0, D1, D2, D3, D4, func);
+        }))
+        return;
 #if IE_THREAD == IE_THREAD_TBB
     auto work_amount = static_cast<size_t>(D0 * D1 * D2 * D3 * D4);
-    int nthr = parallel_get_max_threads();
+    int nthr = parallel_get_work_threads();
     if (static_cast<size_t>(nthr) > work_amount)
         nthr = static_cast<int>(work_amount);
     if (nthr == 1) {
@@ -630,12 +819,12 @@ void parallel_for5d(const T0& D0, const T1& D1, const T2& D2, const T3& D3, cons
             tbb::static_partitioner());
     }
 #elif IE_THREAD == IE_THREAD_TBB_AUTO
-    const int nthr = parallel_get_max_threads();
+    const int nthr = parallel_get_work_threads();
     tbb::parallel_for(0, nthr, [&](int ithr) {
         for_5d(ithr, nthr, D0, D1, D2, D3, D4, func);
     });
 #elif IE_THREAD == IE_THREAD_OMP
-#    pragma omp parallel
+#    pragma omp parallel num_threads(parallel_get_work_threads())
     for_5d(parallel_get_thread_num(), parallel_get_num_threads(), D0, D1, D2, D3, D4, func);
 #elif IE_THREAD == IE_THREAD_SEQ
     for_5d(0, 1, D0, D1, D2, D3, D4, func);
@@ -673,9 +862,13 @@ void for_6d(const int& ithr,
 
 template <typename T0, typename T1, typename T2, typename T3, typename T4, typename T5, typename F>
 void parallel_for6d(const T0& D0, const T1& D1, const T2& D2, const T3& D3, const T4& D4, const T5& D5, const F& func) {
+    if (details::parallel_for_on_pool(static_cast<size_t>(D0 * D1 * D2 * D3 * D4 * D5), [&](int ithr, int nthr) {
+            for_6d(ithr, nthr, D0, D1, D2, D3, D4, D5, func);
+        }))
+        return;
 #if IE_THREAD == IE_THREAD_TBB
     auto work_amount = static_cast<size_t>(D0 * D1 * D2 * D3 * D4 * D5);
-    int nthr = parallel_get_max_threads();
+    int nthr = parallel_get_work_threads();
     if (static_cast<size_t>(nthr) > work_amount)
         nthr = static_cast<int>(work_amount);
     if (nthr == 1) {
@@ -690,12 +883,12 @@ void parallel_for6d(const T0& D0, const T1& D1, const T2& D2, const T3& D3, cons
             tbb::static_partitioner());
     }
 #elif IE_THREAD == IE_THREAD_TBB_AUTO
-    const int nthr = parallel_get_max_threads();
+    const int nthr = parallel_get_work_threads();
     tbb::parallel_for(0, nthr, [&](int ithr) {
         for_6d(ithr, nthr, D0, D1, D2, D3, D4, D5, func);
     });
 #elif IE_THREAD == IE_THREAD_OMP
-#    pragma omp parallel
+#    pragma omp parallel num_threads(parallel_get_work_threads())
     for_6d(parallel_get_thread_num(), parallel_get_num_threads(), D0, D1, D2, D3, D4, D5, func);
 #elif IE_THREAD == IE_THREAD_SEQ
     for_6d(0, 1, D0, D1, D2, D3, D4, D5, func);
@@ -0,0 +1,106 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file that provides ov::CompletionQueue.
+ *
+ * @file openvino/runtime/completion_queue.hpp
+ */
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <vector>
+
+#include "openvino/runtime/common.hpp"
+#include "openvino/runtime/infer_request.hpp"
+
+namespace ov {
+
+/**
+ * @brief This class collects completions of asynchronous inference requests bound to it.
+ *
+ * It allows driving many in-flight requests from a single thread: instead of waiting on every request
+ * or handling completion callbacks, a user polls the queue for finished requests.
+ * @ingroup ov_runtime_cpp_api
+ */
+class OPENVINO_RUNTIME_API CompletionQueue {
+    class Impl;
+    std::shared_ptr<Impl> _impl;
+
+public:
+    /**
+     * @brief Completion of an asynchronous inference request.
+     */
+    struct Completion {
+        /**
+         * @brief A tag given to the request in CompletionQueue::bind.
+         */
+        size_t tag = 0;
+
+        /**
+         * @brief Exception raised by the request or `nullptr` if the inference succeeded.
+         */
+        std::exception_ptr exception = nullptr;
+    };
+
+    /**
+     * @brief Constructs an empty completion queue.
+     */
+    CompletionQueue();
+
+    /**
+     * @brief Destructor. Completions of bound requests finished after the queue destruction are dropped.
+     */
+    ~CompletionQueue();
+
+    /**
+     * @brief Binds an inference request to the queue.
+     *
+     * Every completion of an asynchronous inference started by ov::InferRequest::start_async is pushed to the queue
+     * with the specified tag. The binding replaces a callback set to the request by ov::InferRequest::set_callback.
+     * @param request Inference request to bind.
+     * @param tag A value identifying the request in the queue completions.
+     */
+    void bind(InferRequest& request, size_t tag);
+
+    /**
+     * @brief Pops a completion if it is available.
+     * @param completion Completion to fill.
+     * @return True if a completion was popped and false, otherwise.
+     */
+    bool try_pop(Completion& completion);
+
+    /**
+     * @brief Pops all available completions, but not more than the specified number.
+     * @param completions Vector to append the popped completions to.
+     * @param max_count Maximum number of completions to pop.
+     * @return Number of popped completions.
+     */
+    size_t try_pop(std::vector<Completion>& completions, size_t max_count = static_cast<size_t>(-1));
+
+    /**
+     * @brief Blocks until any bound request completes and pops its completion.
+     * @return Completion of the request.
+     */
+    Completion wait_any();
+
+    /**
+     * @brief Blocks until any bound request completes or the specified timeout has elapsed, whichever comes first.
+     * @param completion Completion to fill.
+     * @param timeout Maximum duration, in milliseconds, to block for.
+     * @return True if a completion was popped and false, otherwise.
+     */
+    bool wait_any_for(Completion& completion, const std::chrono::milliseconds timeout);
+
+    /**
+     * @brief Returns number of completions available in the queue.
+     * @return Number of completions.
+     */
+    size_t size() const;
+};
+
+}  // namespace ov
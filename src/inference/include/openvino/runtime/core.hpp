@@ -9,6 +9,7 @@
  */
 #pragma once
 
+#include <future>
 #include <istream>
 #include <map>
 #include <memory>
@@ -284,6 +285,71 @@ public:
         return compile_model(model, context, AnyMap{std::forward<Properties>(properties)...});
     }
 
+    /**
+     * @brief Starts creating a compiled model from a source model object in background.
+     *
+     * The compilation is performed by the thread pool of the Core, which compiles a bounded number of models
+     * simultaneously, so several models can be compiled in parallel without creating the threads by a user.
+     * The destructor of the last copy of the Core object waits for the compilations started by it.
+     *
+     * @param model Model object acquired from Core::read_model.
+     * @param device_name Name of a device to load a model to.
+     * @param properties Optional map of pairs: (property name, property value) relevant only for this load
+     * operation.
+     * @return A future for the compiled model, it rethrows the compilation exception if any.
+     */
+    std::future<CompiledModel> compile_model_async(const std::shared_ptr<const ov::Model>& model,
+                                                   const std::string& device_name,
+                                                   const AnyMap& properties = {});
+
+    /**
+     * @brief Starts creating a compiled model from a source model object in background.
+     * @tparam Properties Should be the pack of `std::pair<std::string, ov::Any>` types
+     * @param model Model object acquired from Core::read_model
+     * @param device_name Name of device to load model to
+     * @param properties Optional pack of pairs: (property name, property value) relevant only for this
+     * load operation
+     * @return A future for the compiled model
+     */
+    template <typename... Properties>
+    util::EnableIfAllStringAny<std::future<CompiledModel>, Properties...> compile_model_async(
+        const std::shared_ptr<const ov::Model>& model,
+        const std::string& device_name,
+        Properties&&... properties) {
+        return compile_model_async(model, device_name, AnyMap{std::forward<Properties>(properties)...});
+    }
+
+    /**
+     * @brief Starts reading a model and creating a compiled model from the IR/ONNX/PDPD file in background.
+     *
+     * @param model_path Path to a model.
+     * @param device_name Name of a device to load a model to.
+     * @param properties Optional map of pairs: (property name, property value) relevant only for this load
+     * operation.
+     * @return A future for the compiled model, it rethrows the compilation exception if any.
+     * @see Core::compile_model_async(const std::shared_ptr<const ov::Model>&, const std::string&, const AnyMap&)
+     */
+    std::future<CompiledModel> compile_model_async(const std::string& model_path,
+                                                   const std::string& device_name,
+                                                   const AnyMap& properties = {});
+
+    /**
+     * @brief Starts reading a model and creating a compiled model from the IR/ONNX/PDPD file in background.
+     * @tparam Properties Should be a pack of `std::pair<std::string, ov::Any>` types.
+     * @param model_path Path to a model.
+     * @param device_name Name of a device to load a model to.
+     * @param properties Optional pack of pairs: (property name, property value) relevant only for this
+     * load operation.
+     * @return A future for the compiled model
+     */
+    template <typename... Properties>
+    util::EnableIfAllStringAny<std::future<CompiledModel>, Properties...> compile_model_async(
+        const std::string& model_path,
+        const std::string& device_name,
+        Properties&&... properties) {
+        return compile_model_async(model_path, device_name, AnyMap{std::forward<Properties>(properties)...});
+    }
+
     /**
      * @deprecated This method is deprecated. Please use other Core::add_extension methods.
      * @brief Registers OpenVINO 1.0 extension to a Core object.
@@ -47,5 +47,22 @@ namespace intel_cpu {
  */
 static constexpr Property<bool> denormals_optimization{"CPU_DENORMALS_OPTIMIZATION"};
 
+/**
+ * @brief This property defines the minimal sparse rate of FullyConnected weights that makes CPU plugin
+ * execute the layer with the sparse weights kernel.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * Pruned models often have most of the weights equal to zero. Such weights are stored in a block-compressed format
+ * and only non-zero blocks take part in the computation. The sparse rate is the share of the weights skipped by this
+ * format, that is of the input channels equal to zero in a whole block of output channels, so zeros scattered over
+ * the blocks do not count. The value must be in range [0, 1], the default value 1 disables the sparse weights
+ * decompression.
+ *
+ * @code
+ * ie.set_property(ov::intel_cpu::sparse_weights_decompression_rate(0.8));
+ * @endcode
+ */
+static constexpr Property<float> sparse_weights_decompression_rate{"CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE"};
+
 }  // namespace intel_cpu
 }  // namespace ov
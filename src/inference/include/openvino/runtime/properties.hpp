@@ -456,6 +456,28 @@ static constexpr Property<Level> level{"LOG_LEVEL"};
  */
 static constexpr Property<std::string> cache_dir{"CACHE_DIR"};
 
+/**
+ * @brief Read-write property to set the maximum total size in bytes of the compiled blobs stored in ov::cache_dir
+ * @ingroup ov_runtime_cpp_prop_api
+ *
+ * When the limit is exceeded, the least recently used blobs are removed. 0 (default) means no limit.
+ *
+ * @code
+ * ie.set_property(ov::cache_max_size(1024 * 1024 * 1024)); // keeps at most 1GB of cached models
+ * @endcode
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> cache_max_size{"CACHE_MAX_SIZE"};
+
+/**
+ * @brief Read-write property to share the compiled models between the identical compile_model() calls of the core
+ * @ingroup ov_runtime_cpp_prop_api
+ *
+ * When enabled, compiling the same model for the same device with the same properties returns the compiled model
+ * which is still alive instead of compiling (or importing from ov::cache_dir) it again. The infer requests are created
+ * per caller, while the compiled model properties are shared. Disabled by default.
+ */
+static constexpr Property<bool, PropertyMutability::RW> share_compiled_models{"SHARE_COMPILED_MODELS"};
+
 /**
  * @brief Read-only property to provide information about a range for streams on platforms where streams are supported.
  * @ingroup ov_runtime_cpp_prop_api
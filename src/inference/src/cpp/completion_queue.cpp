@@ -0,0 +1,111 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/completion_queue.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+#include "openvino/core/except.hpp"
+
+namespace ov {
+
+class CompletionQueue::Impl {
+public:
+    void push(size_t tag, std::exception_ptr exception) {
+        Completion completion;
+        completion.tag = tag;
+        completion.exception = std::move(exception);
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            _completions.push_back(std::move(completion));
+        }
+        _cv.notify_one();
+    }
+
+    bool pop(Completion& completion) {
+        std::lock_guard<std::mutex> lock{_mutex};
+        if (_completions.empty())
+            return false;
+        completion = std::move(_completions.front());
+        _completions.pop_front();
+        return true;
+    }
+
+    size_t pop(std::vector<Completion>& completions, size_t max_count) {
+        std::lock_guard<std::mutex> lock{_mutex};
+        const size_t count = std::min(max_count, _completions.size());
+        for (size_t i = 0; i < count; ++i) {
+            completions.push_back(std::move(_completions.front()));
+            _completions.pop_front();
+        }
+        return count;
+    }
+
+    bool wait_and_pop(Completion& completion, const std::chrono::milliseconds* timeout) {
+        std::unique_lock<std::mutex> lock{_mutex};
+        auto is_ready = [this] {
+            return !_completions.empty();
+        };
+        if (timeout == nullptr) {
+            _cv.wait(lock, is_ready);
+        } else if (!_cv.wait_for(lock, *timeout, is_ready)) {
+            return false;
+        }
+        completion = std::move(_completions.front());
+        _completions.pop_front();
+        return true;
+    }
+
+    size_t size() const {
+        std::lock_guard<std::mutex> lock{_mutex};
+        return _completions.size();
+    }
+
+private:
+    mutable std::mutex _mutex;
+    std::condition_variable _cv;
+    std::deque<Completion> _completions;
+};
+
+CompletionQueue::CompletionQueue() : _impl{std::make_shared<Impl>()} {}
+
+CompletionQueue::~CompletionQueue() = default;
+
+void CompletionQueue::bind(InferRequest& request, size_t tag) {
+    // The request owns the callback, so the queue is referenced weakly to avoid a reference cycle
+    // and to let the queue be destroyed before the bound requests
+    std::weak_ptr<Impl> weak_impl = _impl;
+    request.set_callback([weak_impl, tag](std::exception_ptr exception) {
+        if (auto impl = weak_impl.lock())
+            impl->push(tag, std::move(exception));
+    });
+}
+
+bool CompletionQueue::try_pop(Completion& completion) {
+    return _impl->pop(completion);
+}
+
+size_t CompletionQueue::try_pop(std::vector<Completion>& completions, size_t max_count) {
+    return _impl->pop(completions, max_count);
+}
+
+CompletionQueue::Completion CompletionQueue::wait_any() {
+    Completion completion;
+    _impl->wait_and_pop(completion, nullptr);
+    return completion;
+}
+
+bool CompletionQueue::wait_any_for(Completion& completion, const std::chrono::milliseconds timeout) {
+    OPENVINO_ASSERT(timeout.count() >= 0, "Timeout must not be negative");
+    return _impl->wait_and_pop(completion, &timeout);
+}
+
+size_t CompletionQueue::size() const {
+    return _impl->size();
+}
+
+}  // namespace ov
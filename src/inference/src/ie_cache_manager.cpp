@@ -0,0 +1,207 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_cache_manager.hpp"
+
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <istream>
+#include <streambuf>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#ifdef _WIN32
+#    include <sys/utime.h>
+#else
+#    include <utime.h>
+#endif
+
+#include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
+
+namespace InferenceEngine {
+
+namespace {
+
+const std::string blobExt = ".blob";
+
+/**
+ * @brief Read-only stream buffer over a memory mapped file, the data is not copied to any intermediate buffer
+ */
+class MappedBlobBuffer : public std::streambuf {
+public:
+    explicit MappedBlobBuffer(std::shared_ptr<ov::util::MappedMemory> memory) : m_memory(std::move(memory)) {
+        auto begin = m_memory->data();
+        setg(begin, begin, begin + m_memory->size());
+    }
+
+protected:
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override {
+        switch (dir) {
+        case std::ios_base::beg:
+            return seekpos(pos_type(off), which);
+        case std::ios_base::cur:
+            return seekpos(pos_type(gptr() - eback() + off), which);
+        case std::ios_base::end:
+            return seekpos(pos_type(egptr() - eback() + off), which);
+        default:
+            return pos_type(off_type(-1));
+        }
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+        const off_type off = pos;
+        if ((which & std::ios_base::out) || off < 0 || off > egptr() - eback())
+            return pos_type(off_type(-1));
+        setg(eback(), eback() + off, egptr());
+        return pos;
+    }
+
+private:
+    std::shared_ptr<ov::util::MappedMemory> m_memory;
+};
+
+// the name is unique for the concurrent writers of the same entry in this and other processes
+std::string makeTempFileName(const std::string& fileName) {
+    static std::atomic<uint64_t> counter{0};
+    const auto threadHash = std::hash<std::thread::id>()(std::this_thread::get_id());
+    const auto time = std::chrono::steady_clock::now().time_since_epoch().count();
+    return fileName + "." + std::to_string(threadHash ^ static_cast<size_t>(time)) + "." +
+           std::to_string(counter++) + ".tmp";
+}
+
+bool replaceFile(const std::string& from, const std::string& to) {
+#ifdef _WIN32
+    // std::rename does not replace the existing files on Windows
+    std::remove(to.c_str());
+#endif
+    return std::rename(from.c_str(), to.c_str()) == 0;
+}
+
+// updates the modification time, which is the last use time for the eviction
+void touchFile(const std::string& fileName) {
+#ifdef _WIN32
+    _utime(fileName.c_str(), nullptr);
+#else
+    utime(fileName.c_str(), nullptr);
+#endif
+}
+
+bool getFileStat(const std::string& fileName, uint64_t& size, int64_t& time) {
+#ifdef _WIN32
+    struct _stat64 st;
+    if (_stat64(fileName.c_str(), &st) != 0)
+        return false;
+#else
+    struct stat st;
+    if (stat(fileName.c_str(), &st) != 0)
+        return false;
+#endif
+    size = static_cast<uint64_t>(st.st_size);
+    time = static_cast<int64_t>(st.st_mtime);
+    return true;
+}
+
+}  // namespace
+
+void FileStorageCacheManager::writeCacheEntry(const std::string& id, StreamWriter writer) {
+    const auto blobFileName = getBlobFile(id);
+    const auto tempFileName = makeTempFileName(blobFileName);
+    bool written = false;
+    try {
+        std::ofstream stream(tempFileName, std::ios_base::binary | std::ofstream::out);
+        writer(stream);
+        stream.close();
+        written = !stream.fail();
+    } catch (...) {
+        std::remove(tempFileName.c_str());
+        throw;
+    }
+
+    // the blob file appears only when it is complete, a failed write just leaves the entry not cached
+    if (!written || !replaceFile(tempFileName, blobFileName)) {
+        std::remove(tempFileName.c_str());
+        return;
+    }
+
+    if (m_maxSize != 0)
+        evictEntries(blobFileName);
+}
+
+void FileStorageCacheManager::readCacheEntry(const std::string& id, StreamReader reader) {
+    auto blobFileName = getBlobFile(id);
+    if (!FileUtils::fileExist(blobFileName))
+        return;
+
+    std::shared_ptr<ov::util::MappedMemory> mappedBlob;
+    try {
+        mappedBlob = ov::util::load_mmap_object(blobFileName);
+    } catch (const std::runtime_error&) {
+        // the entry could be removed by another process, or the file can not be mapped
+    }
+    touchFile(blobFileName);
+
+    if (mappedBlob) {
+        MappedBlobBuffer buffer(mappedBlob);
+        std::istream stream(&buffer);
+        reader(stream);
+    } else if (FileUtils::fileExist(blobFileName)) {
+        std::ifstream stream(blobFileName, std::ios_base::binary);
+        reader(stream);
+    }
+}
+
+void FileStorageCacheManager::removeCacheEntry(const std::string& id) {
+    auto blobFileName = getBlobFile(id);
+    if (FileUtils::fileExist(blobFileName))
+        std::remove(blobFileName.c_str());
+}
+
+void FileStorageCacheManager::evictEntries(const std::string& keptBlobFile) const {
+    struct Entry {
+        std::string fileName;
+        uint64_t size;
+        int64_t time;
+    };
+    std::vector<Entry> entries;
+    uint64_t totalSize = 0;
+    try {
+        ov::util::iterate_files(m_cachePath, [&](const std::string& fileName, bool isDir) {
+            if (isDir || fileName.size() <= blobExt.size() ||
+                fileName.compare(fileName.size() - blobExt.size(), blobExt.size(), blobExt) != 0)
+                return;
+            Entry entry{fileName, 0, 0};
+            if (getFileStat(fileName, entry.size, entry.time)) {
+                totalSize += entry.size;
+                entries.push_back(entry);
+            }
+        });
+    } catch (const std::runtime_error&) {
+        return;
+    }
+    if (totalSize <= m_maxSize)
+        return;
+
+    // the least recently used first
+    std::sort(entries.begin(), entries.end(), [](const Entry& lhs, const Entry& rhs) {
+        return std::tie(lhs.time, lhs.fileName) < std::tie(rhs.time, rhs.fileName);
+    });
+    for (const auto& entry : entries) {
+        if (totalSize <= m_maxSize)
+            break;
+        if (ov::util::get_file_name(entry.fileName) == ov::util::get_file_name(keptBlobFile))
+            continue;
+        // the entry may be already removed or in use by another process
+        if (std::remove(entry.fileName.c_str()) == 0)
+            totalSize -= entry.size;
+    }
+}
+
+}  // namespace InferenceEngine
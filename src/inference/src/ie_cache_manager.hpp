@@ -9,6 +9,7 @@
  */
 #pragma once
 
+#include <cstdint>
 #include <fstream>
 #include <functional>
 #include <memory>
@@ -75,22 +76,31 @@ public:
 /**
  * @brief File storage-based Implementation of ICacheManager
  *
- * Uses simple file for read/write cached models.
+ * Stores each cached model in a `<id>.blob` file. The blobs are written to a temporary file first and renamed
+ * when complete, so concurrent readers never see partially written blobs. The blobs are read through a memory
+ * mapping. If the size limit is set, the least recently used blobs are removed when the total size exceeds it.
  *
  */
 class FileStorageCacheManager final : public ICacheManager {
     std::string m_cachePath;
+    uint64_t m_maxSize;
 
     std::string getBlobFile(const std::string& blobHash) const {
         return FileUtils::makePath(m_cachePath, blobHash + ".blob");
     }
 
+    void evictEntries(const std::string& keptBlobFile) const;
+
 public:
     /**
      * @brief Constructor
+     * @param cachePath The cache directory
+     * @param maxSize The maximum total size of the cached blobs in bytes, 0 means no limit
      *
      */
-    FileStorageCacheManager(std::string cachePath) : m_cachePath(std::move(cachePath)) {}
+    FileStorageCacheManager(std::string cachePath, uint64_t maxSize = 0)
+        : m_cachePath(std::move(cachePath)),
+          m_maxSize(maxSize) {}
 
     /**
      * @brief Destructor
@@ -99,24 +109,11 @@ public:
     ~FileStorageCacheManager() override = default;
 
 private:
-    void writeCacheEntry(const std::string& id, StreamWriter writer) override {
-        std::ofstream stream(getBlobFile(id), std::ios_base::binary | std::ofstream::out);
-        writer(stream);
-    }
+    void writeCacheEntry(const std::string& id, StreamWriter writer) override;
 
-    void readCacheEntry(const std::string& id, StreamReader reader) override {
-        auto blobFileName = getBlobFile(id);
-        if (FileUtils::fileExist(blobFileName)) {
-            std::ifstream stream(blobFileName, std::ios_base::binary);
-            reader(stream);
-        }
-    }
+    void readCacheEntry(const std::string& id, StreamReader reader) override;
 
-    void removeCacheEntry(const std::string& id) override {
-        auto blobFileName = getBlobFile(id);
-        if (FileUtils::fileExist(blobFileName))
-            std::remove(blobFileName.c_str());
-    }
+    void removeCacheEntry(const std::string& id) override;
 };
 
 }  // namespace InferenceEngine
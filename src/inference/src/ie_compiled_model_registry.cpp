@@ -0,0 +1,33 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_compiled_model_registry.hpp"
+
+namespace InferenceEngine {
+
+ov::SoPtr<IExecutableNetworkInternal> CompiledModelRegistry::find(const std::string& key) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_networks.find(key);
+    if (it == m_networks.end())
+        return {};
+    auto network = it->second.network.lock();
+    if (!network)
+        return {};
+    // the library is alive while any user holds the network
+    return {network, it->second.so.lock()};
+}
+
+void CompiledModelRegistry::add(const std::string& key, const ov::SoPtr<IExecutableNetworkInternal>& network) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto it = m_networks.begin(); it != m_networks.end();) {
+        if (it->second.network.expired()) {
+            it = m_networks.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    m_networks[key] = Entry{network._ptr, network._so};
+}
+
+}  // namespace InferenceEngine
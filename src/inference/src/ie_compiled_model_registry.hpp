@@ -0,0 +1,70 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+/**
+ * @brief This is a header file for the Inference Engine Compiled Model Registry class
+ *
+ * @file ie_compiled_model_registry.hpp
+ */
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "cpp_interfaces/interface/ie_iexecutable_network_internal.hpp"
+#include "so_ptr.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief This class holds the compiled models which are alive in the application, so the identical compilation
+ * requests share a single compiled model instead of compiling (or importing) it again.
+ * Each created infer request still belongs to its caller.
+ *
+ * The models are referenced weakly: an entry does not prolong the model lifetime and is dropped once the last
+ * user releases the model.
+ *
+ * Usage example:
+ *     auto key = <calculate hash for network, device and config>;
+ *     auto lock = m_cacheGuard.getHashLock(key);
+ *     auto network = m_registry.find(key);
+ *     if (!network) {
+ *         network = <compile network>;
+ *         m_registry.add(key, network);
+ *     }
+ */
+class CompiledModelRegistry {
+public:
+    CompiledModelRegistry() = default;
+
+    /**
+     * @brief Finds the alive compiled model
+     *
+     * @param key The key identifying the model, device and compilation config
+     * @return The shared compiled model or the empty pointer if there is no alive model for the key
+     */
+    ov::SoPtr<IExecutableNetworkInternal> find(const std::string& key) const;
+
+    /**
+     * @brief Registers the compiled model, the expired entries are removed
+     *
+     * @param key The key identifying the model, device and compilation config
+     * @param network The compiled model
+     */
+    void add(const std::string& key, const ov::SoPtr<IExecutableNetworkInternal>& network);
+
+private:
+    struct Entry {
+        std::weak_ptr<IExecutableNetworkInternal> network;
+        std::weak_ptr<void> so;
+    };
+
+    mutable std::mutex m_mutex;
+    std::unordered_map<std::string, Entry> m_networks;
+};
+
+}  // namespace InferenceEngine
@@ -6,10 +6,13 @@
 
 #include <sys/stat.h>
 
+#include <condition_variable>
+#include <future>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <threading/ie_executor_manager.hpp>
 #include <vector>
 
@@ -24,6 +27,7 @@
 #include "file_utils.h"
 #include "ie_cache_guard.hpp"
 #include "ie_cache_manager.hpp"
+#include "ie_compiled_model_registry.hpp"
 #include "ie_icore.hpp"
 #include "ie_itt.hpp"
 #include "ie_network_reader.hpp"
@@ -247,13 +251,27 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
 
         bool flag_allow_auto_batching = true;
 
+        bool flag_share_compiled_models = false;
+
         void setAndUpdate(ov::AnyMap& config) {
-            auto it = config.find(CONFIG_KEY(CACHE_DIR));
+            auto it = config.find(ov::cache_max_size.name());
+            if (it != config.end()) {
+                std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+                _cacheMaxSize = it->second.as<uint64_t>();
+                // recreate the cache managers with the new limit
+                fillConfig(_cacheConfig, _cacheConfig._cacheDir, _cacheMaxSize);
+                for (auto& deviceCfg : _cacheConfigPerDevice) {
+                    fillConfig(deviceCfg.second, deviceCfg.second._cacheDir, _cacheMaxSize);
+                }
+                config.erase(it);
+            }
+
+            it = config.find(CONFIG_KEY(CACHE_DIR));
             if (it != config.end()) {
                 std::lock_guard<std::mutex> lock(_cacheConfigMutex);
-                fillConfig(_cacheConfig, it->second.as<std::string>());
+                fillConfig(_cacheConfig, it->second.as<std::string>(), _cacheMaxSize);
                 for (auto& deviceCfg : _cacheConfigPerDevice) {
-                    fillConfig(deviceCfg.second, it->second.as<std::string>());
+                    fillConfig(deviceCfg.second, it->second.as<std::string>(), _cacheMaxSize);
                 }
                 config.erase(it);
             }
@@ -271,11 +289,17 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
                 flag_allow_auto_batching = flag;
                 config.erase(it);
             }
+
+            it = config.find(ov::share_compiled_models.name());
+            if (it != config.end()) {
+                flag_share_compiled_models = it->second.as<bool>();
+                config.erase(it);
+            }
         }
 
         void setCacheForDevice(const std::string& dir, const std::string& name) {
             std::lock_guard<std::mutex> lock(_cacheConfigMutex);
-            fillConfig(_cacheConfigPerDevice[name], dir);
+            fillConfig(_cacheConfigPerDevice[name], dir, _cacheMaxSize);
         }
 
         std::string get_cache_dir() const {
@@ -283,6 +307,11 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
             return _cacheConfig._cacheDir;
         }
 
+        uint64_t get_cache_max_size() const {
+            std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+            return _cacheMaxSize;
+        }
+
         // Creating thread-safe copy of config including shared_ptr to ICacheManager
         // Passing empty or not-existing name will return global cache config
         CacheConfig getCacheConfigForDevice(const std::string& device_name,
@@ -290,7 +319,7 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
                                             std::map<std::string, std::string>& parsedConfig) const {
             if (parsedConfig.count(CONFIG_KEY(CACHE_DIR))) {
                 CoreConfig::CacheConfig tempConfig;
-                CoreConfig::fillConfig(tempConfig, parsedConfig.at(CONFIG_KEY(CACHE_DIR)));
+                CoreConfig::fillConfig(tempConfig, parsedConfig.at(CONFIG_KEY(CACHE_DIR)), get_cache_max_size());
                 if (!deviceSupportsCacheDir) {
                     parsedConfig.erase(CONFIG_KEY(CACHE_DIR));
                 }
@@ -315,11 +344,11 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
         }
 
     private:
-        static void fillConfig(CacheConfig& config, const std::string& dir) {
+        static void fillConfig(CacheConfig& config, const std::string& dir, uint64_t maxSize) {
             config._cacheDir = dir;
             if (!dir.empty()) {
                 FileUtils::createDirectoryRecursive(dir);
-                config._cacheManager = std::make_shared<ie::FileStorageCacheManager>(dir);
+                config._cacheManager = std::make_shared<ie::FileStorageCacheManager>(dir, maxSize);
             } else {
                 config._cacheManager = nullptr;
             }
@@ -329,6 +358,7 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
         mutable std::mutex _cacheConfigMutex;
         CacheConfig _cacheConfig;
         std::map<std::string, CacheConfig> _cacheConfigPerDevice;
+        uint64_t _cacheMaxSize = 0;
     };
 
     struct CacheContent {
@@ -346,6 +376,8 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
 
     ie::CacheGuard cacheGuard;
 
+    ie::CompiledModelRegistry sharedCompiledModels;
+
     struct PluginDescriptor {
         ov::util::FilePath libraryLocation;
         ov::AnyMap defaultConfig;
@@ -545,6 +577,12 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
         return ie::NetworkCompilationContext::computeHash(modelName, compileConfig);
     }
 
+    // the key of the compiled model shared between the identical LoadNetwork calls, the model hash takes into
+    // account the whole config, not only the properties which affect the compiled blob
+    static std::string SharedModelKey(const std::string& deviceName, const std::string& modelHash) {
+        return "shared_model:" + deviceName + ":" + modelHash;
+    }
+
 public:
     CoreImpl(bool _newAPI) : newAPI(_newAPI) {
         add_mutex("");  // Register global mutex
@@ -825,6 +863,17 @@ public:
         }
         auto plugin = GetCPPPluginByName(parsed._deviceName);
         ov::SoPtr<ie::IExecutableNetworkInternal> res;
+        std::string sharedModelKey;
+        std::unique_ptr<ie::CacheGuardEntry> sharedModelLock;
+        if (coreConfig.flag_share_compiled_models) {
+            sharedModelKey =
+                SharedModelKey(parsed._deviceName, ie::NetworkCompilationContext::computeHash(network, parsed._config));
+            sharedModelLock = cacheGuard.getHashLock(sharedModelKey);
+            res = sharedCompiledModels.find(sharedModelKey);
+            if (res._ptr) {
+                return {res._ptr, res._so};
+            }
+        }
         auto cacheManager =
             coreConfig.getCacheConfigForDevice(parsed._deviceName, DeviceSupportsCacheDir(plugin), parsed._config)
                 ._cacheManager;
@@ -843,6 +892,9 @@ public:
         } else {
             res = compile_model_impl(network, plugin, parsed._config, nullptr, cacheContent, forceDisableCache);
         }
+        if (sharedModelLock) {
+            sharedCompiledModels.add(sharedModelKey, res);
+        }
         return {res._ptr, res._so};
     }
 
@@ -854,6 +906,17 @@ public:
         auto parsed = parseDeviceNameIntoConfig(deviceName, config);
         auto plugin = GetCPPPluginByName(parsed._deviceName);
         ov::SoPtr<ie::IExecutableNetworkInternal> res;
+        std::string sharedModelKey;
+        std::unique_ptr<ie::CacheGuardEntry> sharedModelLock;
+        if (coreConfig.flag_share_compiled_models) {
+            sharedModelKey =
+                SharedModelKey(parsed._deviceName, ie::NetworkCompilationContext::computeHash(modelPath, parsed._config));
+            sharedModelLock = cacheGuard.getHashLock(sharedModelKey);
+            res = sharedCompiledModels.find(sharedModelKey);
+            if (res._ptr) {
+                return {res._ptr, res._so};
+            }
+        }
         auto cacheManager =
             coreConfig.getCacheConfigForDevice(parsed._deviceName, DeviceSupportsCacheDir(plugin), parsed._config)
                 ._cacheManager;
@@ -880,6 +943,9 @@ public:
             }
             res = compile_model_impl(cnnNetwork, plugin, parsed._config, nullptr, cacheContent);
         }
+        if (sharedModelLock) {
+            sharedCompiledModels.add(sharedModelKey, res);
+        }
         return {res._ptr, res._so};
     }
 
@@ -1021,9 +1087,14 @@ public:
             return decltype(ov::force_tbb_terminate)::value_type(flag);
         } else if (name == ov::cache_dir.name()) {
             return ov::Any(coreConfig.get_cache_dir());
+        } else if (name == ov::cache_max_size.name()) {
+            return decltype(ov::cache_max_size)::value_type(coreConfig.get_cache_max_size());
         } else if (name == ov::hint::allow_auto_batching.name()) {
             const auto flag = coreConfig.flag_allow_auto_batching;
             return decltype(ov::hint::allow_auto_batching)::value_type(flag);
+        } else if (name == ov::share_compiled_models.name()) {
+            const auto flag = coreConfig.flag_share_compiled_models;
+            return decltype(ov::share_compiled_models)::value_type(flag);
         }
 
         IE_THROW() << "Exception is thrown while trying to call get_property with unsupported property: '" << name
@@ -1926,10 +1997,88 @@ namespace ov {
 class Core::Impl : public CoreImpl {
 public:
     Impl() : ov::CoreImpl(true) {}
+
+    ~Impl() override {
+        // the compilation tasks do not own the core, so it waits for them
+        wait_compile_tasks();
+    }
+
+    /**
+     * @brief Creates the core shared by the ov::Core objects. When the last of them is destroyed, the compilation
+     * tasks are finished while the core is still alive, so the plugins can get the core from a task and the task never
+     * releases the last reference to it.
+     */
+    static std::shared_ptr<Impl> create() {
+        auto owner = std::make_shared<Owner>();
+        owner->impl = std::make_shared<Impl>();
+        return std::shared_ptr<Impl>(owner, owner->impl.get());
+    }
+
+    std::future<CompiledModel> compile_model_async(std::function<CompiledModel()> compile) {
+        auto task = std::make_shared<std::packaged_task<CompiledModel()>>(std::move(compile));
+        auto future = task->get_future();
+        {
+            std::lock_guard<std::mutex> lock(compile_tasks_mutex);
+            compile_tasks++;
+        }
+        try {
+            get_compile_executor()->run([this, task] {
+                (*task)();
+                finish_compile_task();
+            });
+        } catch (...) {
+            finish_compile_task();
+            throw;
+        }
+        return future;
+    }
+
+private:
+    // the models are compiled by the streams of the executor, each compilation uses the shared threads
+    // for its own parallel work, so the number of simultaneous compilations is limited to bound the memory
+    ie::IStreamsExecutor::Ptr get_compile_executor() {
+        std::lock_guard<std::mutex> lock(compile_executor_mutex);
+        if (!compile_executor) {
+            const int streams = std::max(1, std::min(static_cast<int>(std::thread::hardware_concurrency()), 8));
+            compile_executor = executorManager()->getIdleCPUStreamsExecutor(
+                ie::IStreamsExecutor::Config{"CoreCompileModelAsync",
+                                             streams,
+                                             0 /*default threads per stream*/,
+                                             ie::IStreamsExecutor::ThreadBindingType::NONE});
+        }
+        return compile_executor;
+    }
+
+    struct Owner {
+        ~Owner() {
+            impl->wait_compile_tasks();
+        }
+        std::shared_ptr<Impl> impl;
+    };
+
+    void wait_compile_tasks() {
+        std::unique_lock<std::mutex> lock(compile_tasks_mutex);
+        compile_tasks_done.wait(lock, [this] {
+            return compile_tasks == 0;
+        });
+    }
+
+    void finish_compile_task() {
+        std::lock_guard<std::mutex> lock(compile_tasks_mutex);
+        if (--compile_tasks == 0)
+            compile_tasks_done.notify_all();
+    }
+
+    std::mutex compile_executor_mutex;
+    ie::IStreamsExecutor::Ptr compile_executor;
+    // the number of the started and not finished compilation tasks
+    std::mutex compile_tasks_mutex;
+    std::condition_variable compile_tasks_done;
+    size_t compile_tasks = 0;
 };
 
 Core::Core(const std::string& xmlConfigFile) {
-    _impl = std::make_shared<Impl>();
+    _impl = Impl::create();
 
 #ifdef OPENVINO_STATIC_LIBRARY
     _impl->RegisterPluginsInRegistry(::getStaticPluginsRegistry());
@@ -2002,6 +2151,37 @@ CompiledModel Core::compile_model(const std::string& modelPath, const std::strin
     });
 }
 
+std::future<CompiledModel> Core::compile_model_async(const std::shared_ptr<const ov::Model>& model,
+                                                     const std::string& deviceName,
+                                                     const AnyMap& config) {
+    OV_CORE_CALL_STATEMENT({
+        // the last copy of the core waits for the task in its destructor, so the task does not own the core
+        auto impl = _impl.get();
+        auto properties = any_copy(flatten_sub_properties(deviceName, config));
+        return _impl->compile_model_async([impl, model, deviceName, properties]() -> CompiledModel {
+            OV_CORE_CALL_STATEMENT({
+                auto exec = impl->LoadNetwork(toCNN(model), deviceName, properties);
+                return {exec._ptr, exec._so};
+            });
+        });
+    });
+}
+
+std::future<CompiledModel> Core::compile_model_async(const std::string& modelPath,
+                                                     const std::string& deviceName,
+                                                     const AnyMap& config) {
+    OV_CORE_CALL_STATEMENT({
+        auto impl = _impl.get();
+        auto properties = any_copy(flatten_sub_properties(deviceName, config));
+        return _impl->compile_model_async([impl, modelPath, deviceName, properties]() -> CompiledModel {
+            OV_CORE_CALL_STATEMENT({
+                auto exec = impl->LoadNetwork(modelPath, deviceName, properties);
+                return {exec._ptr, exec._so};
+            });
+        });
+    });
+}
+
 CompiledModel Core::compile_model(const std::shared_ptr<const ov::Model>& model,
                                   const RemoteContext& context,
                                   const AnyMap& config) {
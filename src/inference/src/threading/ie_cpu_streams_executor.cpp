@@ -20,12 +20,28 @@
 #include "ie_parallel_custom_arena.hpp"
 #include "ie_system_conf.h"
 #include "threading/ie_executor_manager.hpp"
+#include "threading/ie_spin_thread_pool.hpp"
 #include "threading/ie_thread_affinity.hpp"
 #include "threading/ie_thread_local.hpp"
 
 using namespace openvino;
 
 namespace InferenceEngine {
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+namespace {
+// sets the parallel pool for the tasks executed by the current thread
+struct ParallelPoolGuard {
+    explicit ParallelPoolGuard(IParallelPool* pool) : _prevPool(parallel_get_pool()) {
+        parallel_set_pool(pool);
+    }
+    ~ParallelPoolGuard() {
+        parallel_set_pool(_prevPool);
+    }
+    IParallelPool* _prevPool;
+};
+}  // namespace
+#endif
+
 struct CPUStreamsExecutor::Impl {
     struct Stream {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
@@ -61,6 +77,23 @@ struct CPUStreamsExecutor::Impl {
             }
             ~Observer() override = default;
         };
+        // The arena worker threads share the cores with the spin pool workers, so the latter do not spin
+        // while the threading library works, e.g. executes oneDNN primitives.
+        struct PoolObserver : public custom::task_scheduler_observer {
+            SpinThreadPool& _pool;
+            PoolObserver(custom::task_arena& arena, SpinThreadPool& pool)
+                : custom::task_scheduler_observer(arena),
+                  _pool(pool) {}
+            void on_scheduler_entry(bool isWorker) override {
+                if (isWorker)
+                    _pool.set_external_thread_active(true);
+            }
+            void on_scheduler_exit(bool isWorker) override {
+                if (isWorker)
+                    _pool.set_external_thread_active(false);
+            }
+            ~PoolObserver() override = default;
+        };
 #endif
         explicit Stream(Impl* impl) : _impl(impl) {
             {
@@ -206,6 +239,44 @@ struct CPUStreamsExecutor::Impl {
                                           processMask);
                 }
             }
+#endif
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+            if (_impl->_config._spinThreadPool) {
+                // the pool workers take the places of the arena threads, so the arena is needed to know them
+                if (nullptr == _taskArena) {
+                    _taskArena.reset(new custom::task_arena{concurrency});
+                }
+                const int poolThreads = _taskArena->max_concurrency();
+                if (poolThreads > 1) {
+                    std::function<void(int)> pinWorker;
+                    if (nullptr != _observer) {
+                        // the same cores as the arena thread with the same index, including the hybrid cores binding
+                        const int offset = _observer->_offset;
+                        const int threadBindingStep = _observer->_threadBindingStep;
+                        const int cpuIdxOffset = _observer->_cpuIdxOffset;
+                        pinWorker = [offset, threadBindingStep, cpuIdxOffset](int threadIndex) {
+                            CpuSet processMask;
+                            int ncpus = 0;
+                            std::tie(processMask, ncpus) = GetProcessMask();
+                            if (nullptr != processMask) {
+                                PinThreadToVacantCore(offset + threadIndex,
+                                                      threadBindingStep,
+                                                      ncpus,
+                                                      processMask,
+                                                      cpuIdxOffset);
+                            }
+                        };
+                    } else if (ThreadBindingType::NUMA == _impl->_config._threadBindingType) {
+                        const int numaNodeId = _numaNodeId;
+                        pinWorker = [numaNodeId](int) {
+                            PinCurrentThreadToSocket(numaNodeId);
+                        };
+                    }
+                    _pool = std::make_shared<SpinThreadPool>(poolThreads, std::move(pinWorker));
+                    _poolObserver.reset(new PoolObserver{*_taskArena, *_pool});
+                    _poolObserver->observe(true);
+                }
+            }
 #endif
         }
         ~Stream() {
@@ -214,6 +285,9 @@ struct CPUStreamsExecutor::Impl {
                 _impl->_streamIdQueue.push(_streamId);
             }
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+            if (nullptr != _poolObserver) {
+                _poolObserver->observe(false);
+            }
             if (nullptr != _observer) {
                 _observer->observe(false);
             }
@@ -228,6 +302,8 @@ struct CPUStreamsExecutor::Impl {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
         std::unique_ptr<custom::task_arena> _taskArena;
         std::unique_ptr<Observer> _observer;
+        std::shared_ptr<SpinThreadPool> _pool;
+        std::unique_ptr<PoolObserver> _poolObserver;
 #endif
     };
 
@@ -308,11 +384,15 @@ struct CPUStreamsExecutor::Impl {
 
     void Execute(const Task& task, Stream& stream) {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+        const auto execute = [&] {
+            ParallelPoolGuard poolGuard{stream._pool.get()};
+            task();
+        };
         auto& arena = stream._taskArena;
         if (nullptr != arena) {
-            arena->execute(std::move(task));
+            arena->execute(execute);
         } else {
-            task();
+            execute();
         }
 #else
         task();
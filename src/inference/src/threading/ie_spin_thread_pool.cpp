@@ -0,0 +1,217 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "threading/ie_spin_thread_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ie_common.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#    include <immintrin.h>
+#endif
+
+namespace InferenceEngine {
+
+namespace {
+thread_local IParallelPool* currentPool = nullptr;
+// index of the current thread in the pool it works for, 0 for the threads the pools are set for
+thread_local int currentThreadNum = 0;
+
+// the number of the busy wait iterations of an idle worker before it parks, about tens of microseconds
+constexpr int spinIterations = 4096;
+
+inline void spinPause() {
+#if defined(__x86_64__) || defined(_M_X64)
+    _mm_pause();
+#else
+    std::this_thread::yield();
+#endif
+}
+}  // namespace
+
+IParallelPool* parallel_get_pool() {
+    return currentPool;
+}
+
+void parallel_set_pool(IParallelPool* pool) {
+    currentPool = pool;
+}
+
+struct SpinThreadPool::Impl {
+    struct Worker {
+        // the id of the last job assigned to the worker
+        std::atomic<uint64_t> job{0};
+        std::atomic<bool> parked{false};
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::thread thread;
+    };
+
+    Impl(SpinThreadPool* pool, int threads, std::function<void(int)> onWorkerStart)
+        : _threads(threads),
+          _onWorkerStart(std::move(onWorkerStart)) {
+        for (int idx = 1; idx < _threads; idx++) {
+            _workers.emplace_back(new Worker);
+        }
+        for (int idx = 1; idx < _threads; idx++) {
+            _workers[idx - 1]->thread = std::thread([this, pool, idx] {
+                workerLoop(pool, idx);
+            });
+        }
+    }
+
+    ~Impl() {
+        _stopped.store(true);
+        const auto jobId = ++_jobId;
+        for (auto& worker : _workers) {
+            notify(*worker, jobId);
+        }
+        for (auto& worker : _workers) {
+            if (worker->thread.joinable())
+                worker->thread.join();
+        }
+    }
+
+    void notify(Worker& worker, uint64_t jobId) {
+        worker.job.store(jobId);
+        // the worker sets the flag before checking the job under the mutex, so the wake-up can not be lost
+        if (worker.parked.load()) {
+            { std::lock_guard<std::mutex> lock(worker.mutex); }
+            worker.cv.notify_one();
+        }
+    }
+
+    void workerLoop(SpinThreadPool* pool, int idx) {
+        parallel_set_pool(pool);
+        currentThreadNum = idx;
+        if (_onWorkerStart)
+            _onWorkerStart(idx);
+
+        auto& worker = *_workers[idx - 1];
+        uint64_t seen = 0;
+        while (true) {
+            uint64_t job = worker.job.load(std::memory_order_acquire);
+            for (int i = 0; job == seen && i < spinIterations && _externalThreads.load(std::memory_order_relaxed) == 0;
+                 i++) {
+                spinPause();
+                job = worker.job.load(std::memory_order_acquire);
+            }
+            if (job == seen) {
+                worker.parked.store(true);
+                std::unique_lock<std::mutex> lock(worker.mutex);
+                worker.cv.wait(lock, [&] {
+                    job = worker.job.load();
+                    return job != seen;
+                });
+                worker.parked.store(false);
+            }
+            seen = job;
+            if (_stopped.load())
+                return;
+
+            execute(idx);
+            _pending.fetch_sub(1, std::memory_order_acq_rel);
+        }
+    }
+
+    // static assignment: the pool thread idx processes the chunks idx, idx + active, ...
+    void execute(int idx) {
+        try {
+            for (int ithr = idx; ithr < _nthr; ithr += _active) {
+                (*_func)(ithr, _nthr);
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(_exceptionMutex);
+            if (!_exception)
+                _exception = std::current_exception();
+        }
+    }
+
+    const int _threads;
+    std::function<void(int)> _onWorkerStart;
+    std::vector<std::unique_ptr<Worker>> _workers;
+
+    // the current job, written by the calling thread before the workers are notified
+    const std::function<void(int, int)>* _func = nullptr;
+    int _nthr = 0;
+    int _active = 0;
+    uint64_t _jobId = 0;
+    bool _running = false;
+
+    std::atomic<int> _pending{0};
+    std::atomic<bool> _stopped{false};
+    // the threads of the threading library working on the same cores
+    std::atomic<int> _externalThreads{0};
+    std::mutex _exceptionMutex;
+    std::exception_ptr _exception;
+};
+
+SpinThreadPool::SpinThreadPool(int threads, std::function<void(int)> onWorkerStart) {
+    if (threads < 1)
+        IE_THROW() << "SpinThreadPool expects a positive number of threads, got " << threads;
+    _impl.reset(new Impl(this, threads, std::move(onWorkerStart)));
+}
+
+SpinThreadPool::~SpinThreadPool() = default;
+
+int SpinThreadPool::get_threads() const {
+    return _impl->_threads;
+}
+
+int SpinThreadPool::get_thread_num() const {
+    return currentThreadNum;
+}
+
+void SpinThreadPool::run(int nthr, const std::function<void(int, int)>& func) {
+    auto& impl = *_impl;
+    // nested calls from the pool threads are executed sequentially
+    if (nthr <= 1 || impl._threads == 1 || impl._running || currentThreadNum != 0) {
+        for (int ithr = 0; ithr < nthr; ithr++) {
+            func(ithr, nthr);
+        }
+        return;
+    }
+
+    impl._running = true;
+    impl._func = &func;
+    impl._nthr = nthr;
+    impl._active = std::min(nthr, impl._threads);
+    impl._pending.store(impl._active - 1, std::memory_order_relaxed);
+    const auto jobId = ++impl._jobId;
+    for (int idx = 1; idx < impl._active; idx++) {
+        impl.notify(*impl._workers[idx - 1], jobId);
+    }
+
+    impl.execute(0);
+    for (int i = 0; impl._pending.load(std::memory_order_acquire) != 0; i++) {
+        // let the workers progress if the cores are oversubscribed
+        if (i < spinIterations) {
+            spinPause();
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    impl._running = false;
+
+    if (impl._exception) {
+        auto exception = impl._exception;
+        impl._exception = nullptr;
+        std::rethrow_exception(exception);
+    }
+}
+
+void SpinThreadPool::set_external_thread_active(bool active) {
+    _impl->_externalThreads.fetch_add(active ? 1 : -1, std::memory_order_relaxed);
+}
+
+}  // namespace InferenceEngine
@@ -1340,6 +1340,60 @@ TEST_P(CachingTest, TestCacheDirCreateRecursive) {
     CommonTestUtils::removeDir(newCacheDir1);
 }
 
+TEST_P(CachingTest, TestShareCompiledModels) {
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_CONFIG_KEYS), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(ov::supported_properties.name(), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_METRICS), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(IMPORT_EXPORT_SUPPORT), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(DEVICE_ARCHITECTURE), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _, _)).Times(m_remoteContext ? 3 : 0);
+    EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _)).Times(!m_remoteContext ? 2 : 0);
+    EXPECT_CALL(*mockPlugin, ImportNetwork(_, _, _)).Times(0);
+    EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(0);
+    testLoad([&](Core &ie) {
+        ie.SetConfig({{ov::share_compiled_models.name(), CONFIG_VALUE(YES)}});
+        {
+            auto first = m_testFunction(ie);
+            auto second = m_testFunction(ie);
+            // the models loaded with a remote context are not shared
+            if (!m_remoteContext) {
+                EXPECT_EQ(networks.size(), 1);
+            }
+        }
+        // the released model is compiled again
+        m_testFunction(ie);
+    });
+}
+
+TEST_P(CachingTest, TestCacheMaxSize) {
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_CONFIG_KEYS), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(ov::supported_properties.name(), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_METRICS), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(IMPORT_EXPORT_SUPPORT), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(DEVICE_ARCHITECTURE), _)).Times(AnyNumber())
+            .WillRepeatedly(Invoke([&](const std::string&, const std::map<std::string, Parameter>& options) {
+                return "mock_architecture_" + options.at("DEVICE_ID").as<std::string>();
+            }));
+    EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _, _)).Times(m_remoteContext ? 2 : 0);
+    EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _)).Times(!m_remoteContext ? 2 : 0);
+    EXPECT_CALL(*mockPlugin, ImportNetwork(_, _, _)).Times(0);
+    EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(0);
+    m_post_mock_net_callbacks.emplace_back([&](MockExecutableNetwork& net) {
+        EXPECT_CALL(net, Export(_)).Times(1);
+    });
+    testLoad([&](Core &ie) {
+        ie.SetConfig({{CONFIG_KEY(CACHE_DIR), m_cacheDir}, {ov::cache_max_size.name(), "1"}});
+        deviceToLoad = "mock.0";
+        m_testFunction(ie);
+        EXPECT_EQ(CommonTestUtils::listFilesWithExt(m_cacheDir, "blob").size(), 1);
+        deviceToLoad = "mock.1";
+        m_testFunction(ie);
+    });
+    // the least recently used blob is evicted, no temporary files are left
+    EXPECT_EQ(CommonTestUtils::listFilesWithExt(m_cacheDir, "blob").size(), 1);
+    EXPECT_EQ(CommonTestUtils::listFilesWithExt(m_cacheDir, "tmp").size(), 0);
+}
+
 TEST_P(CachingTest, TestDeviceArchitecture) {
     EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_CONFIG_KEYS), _)).Times(AnyNumber());
     EXPECT_CALL(*mockPlugin, GetMetric(ov::supported_properties.name(), _)).Times(AnyNumber());
@@ -0,0 +1,38 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <openvino/core/except.hpp>
+#include <openvino/runtime/completion_queue.hpp>
+
+using namespace ::testing;
+
+TEST(CompletionQueueOVTests, throwsOnBindUninitializedRequest) {
+    ov::CompletionQueue queue;
+    ov::InferRequest req;
+    ASSERT_THROW(queue.bind(req, 0), ov::Exception);
+}
+
+TEST(CompletionQueueOVTests, tryPopReturnsFalseOnEmptyQueue) {
+    ov::CompletionQueue queue;
+    ov::CompletionQueue::Completion completion;
+    ASSERT_FALSE(queue.try_pop(completion));
+    std::vector<ov::CompletionQueue::Completion> completions;
+    ASSERT_EQ(0, queue.try_pop(completions));
+    ASSERT_TRUE(completions.empty());
+    ASSERT_EQ(0, queue.size());
+}
+
+TEST(CompletionQueueOVTests, waitAnyForReturnsFalseOnTimeout) {
+    ov::CompletionQueue queue;
+    ov::CompletionQueue::Completion completion;
+    ASSERT_FALSE(queue.wait_any_for(completion, std::chrono::milliseconds(1)));
+}
+
+TEST(CompletionQueueOVTests, throwsOnNegativeTimeout) {
+    ov::CompletionQueue queue;
+    ov::CompletionQueue::Completion completion;
+    ASSERT_THROW(queue.wait_any_for(completion, std::chrono::milliseconds(-1)), ov::Exception);
+}
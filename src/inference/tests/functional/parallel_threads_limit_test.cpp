@@ -0,0 +1,41 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <ie_parallel.hpp>
+#include <atomic>
+
+using namespace InferenceEngine;
+
+TEST(ParallelThreadsLimitTests, limitsWorkThreadsInScope) {
+    const int maxThreads = parallel_get_max_threads();
+    ASSERT_EQ(maxThreads, parallel_get_work_threads());
+    {
+        ParallelThreadsLimit outer(1);
+        ASSERT_EQ(1, parallel_get_work_threads());
+        {
+            ParallelThreadsLimit inner(0);
+            ASSERT_EQ(maxThreads, parallel_get_work_threads());
+        }
+        ASSERT_EQ(1, parallel_get_work_threads());
+    }
+    ASSERT_EQ(maxThreads, parallel_get_work_threads());
+}
+
+TEST(ParallelThreadsLimitTests, parallelForRunsSerialUnderLimit) {
+    ParallelThreadsLimit limit(1);
+
+    std::atomic<int> iterations{0};
+    parallel_for(100, [&](int) {
+        ASSERT_EQ(0, parallel_get_thread_num());
+        iterations++;
+    });
+    ASSERT_EQ(100, iterations.load());
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        ASSERT_EQ(0, ithr);
+        ASSERT_EQ(1, nthr);
+    });
+}
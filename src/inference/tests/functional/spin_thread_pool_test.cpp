@@ -0,0 +1,145 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include <ie_parallel.hpp>
+#include <threading/ie_cpu_streams_executor.hpp>
+#include <threading/ie_spin_thread_pool.hpp>
+
+using namespace InferenceEngine;
+
+TEST(SpinThreadPoolTests, runCallsEachChunkOnce) {
+    SpinThreadPool pool(3);
+    for (int nthr : {1, 2, 3, 7}) {
+        std::vector<std::atomic<int>> calls(nthr);
+        for (auto& c : calls)
+            c = 0;
+        pool.run(nthr, [&](int ithr, int n) {
+            ASSERT_EQ(nthr, n);
+            calls[ithr]++;
+        });
+        for (auto& c : calls)
+            ASSERT_EQ(1, c.load());
+    }
+}
+
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+TEST(SpinThreadPoolTests, parallelHelpersUseThePool) {
+    // the streams executor sets the pool for the tasks executed in the arena of the same concurrency
+    tbb::task_arena arena(4);
+    SpinThreadPool pool(4);
+    std::atomic<int> sum{0};
+    arena.execute([&] {
+        parallel_set_pool(&pool);
+        ASSERT_EQ(4, parallel_get_max_threads());
+        parallel_for2d(5, 7, [&](int d0, int d1) {
+            ASSERT_EQ(4, parallel_get_max_threads());
+            ASSERT_LT(parallel_get_thread_num(), 4);
+            // nested calls are executed sequentially
+            parallel_for(2, [&](int) {
+                sum++;
+            });
+            sum += d0 * 7 + d1;
+        });
+        parallel_set_pool(nullptr);
+    });
+    ASSERT_EQ(35 * 34 / 2 + 70, sum.load());
+}
+#endif
+
+TEST(SpinThreadPoolTests, threadNumIsThePoolThreadOfTheChunk) {
+    SpinThreadPool pool(3);
+    parallel_set_pool(&pool);
+    std::vector<int> threadNums(7, -1);
+    std::vector<int> nestedThreadNums(7, -1);
+    parallel_nt(7, [&](int ithr, int) {
+        threadNums[ithr] = parallel_get_thread_num();
+        parallel_nt(2, [&](int, int) {
+            nestedThreadNums[ithr] = parallel_get_thread_num();
+        });
+    });
+    parallel_set_pool(nullptr);
+    for (int ithr = 0; ithr < 7; ithr++) {
+        ASSERT_EQ(ithr % 3, threadNums[ithr]);
+        ASSERT_EQ(ithr % 3, nestedThreadNums[ithr]);
+    }
+}
+
+TEST(SpinThreadPoolTests, runWhileExternalThreadsAreActive) {
+    SpinThreadPool pool(3);
+    pool.set_external_thread_active(true);
+    std::atomic<int> calls{0};
+    for (int i = 0; i < 100; i++) {
+        pool.run(3, [&](int, int) {
+            calls++;
+        });
+    }
+    pool.set_external_thread_active(false);
+    ASSERT_EQ(300, calls.load());
+}
+
+TEST(SpinThreadPoolTests, runRethrowsException) {
+    SpinThreadPool pool(2);
+    ASSERT_THROW(pool.run(4,
+                          [](int ithr, int) {
+                              if (ithr == 3)
+                                  throw std::runtime_error("chunk failed");
+                          }),
+                 std::runtime_error);
+}
+
+TEST(SpinThreadPoolTests, streamsExecutorSetsThePool) {
+    IStreamsExecutor::Config config{"SpinPoolStreams", 1, 2};
+    config._spinThreadPool = true;
+    auto executor = std::make_shared<CPUStreamsExecutor>(config);
+
+    int threads = 0;
+    int maxThreads = 0;
+    executor->runAndWait({[&] {
+        threads = parallel_get_pool() ? parallel_get_pool()->get_threads() : 0;
+        maxThreads = parallel_get_max_threads();
+    }});
+    ASSERT_EQ(2, threads);
+    // the pool threads are the arena threads, so the threads number is known without asking the pool
+    ASSERT_EQ(threads, maxThreads);
+}
+
+// Compares the time of a sequence of small parallel regions executed by the stream arena and by the spin pool.
+// It is disabled by default, run it with --gtest_also_run_disabled_tests.
+TEST(SpinThreadPoolTests, DISABLED_smallParallelRegionsBenchmark) {
+    constexpr int regions = 20000;
+    const int threads = std::max(2, parallel_get_max_threads());
+
+    auto measure = [&](bool spinThreadPool) {
+        IStreamsExecutor::Config config{"SpinPoolBenchmark", 1, threads};
+        config._spinThreadPool = spinThreadPool;
+        auto executor = std::make_shared<CPUStreamsExecutor>(config);
+        std::vector<float> data(threads * 64, 1.f);
+        double microseconds = 0;
+        executor->runAndWait({[&] {
+            const auto start = std::chrono::steady_clock::now();
+            for (int r = 0; r < regions; r++) {
+                parallel_for(data.size(), [&](size_t i) {
+                    data[i] = data[i] * 0.5f + 0.5f;
+                });
+            }
+            const auto end = std::chrono::steady_clock::now();
+            microseconds = std::chrono::duration<double, std::micro>(end - start).count();
+        }});
+        return microseconds / regions;
+    };
+
+    const double arenaRegion = measure(false);
+    const double poolRegion = measure(true);
+    std::cout << "[ BENCHMARK ] " << threads << " threads, parallel region on the arena: " << arenaRegion
+              << " us, on the spin pool: " << poolRegion << " us" << std::endl;
+}
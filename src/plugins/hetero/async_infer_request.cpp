@@ -4,8 +4,12 @@
 
 #include "async_infer_request.hpp"
 
+#include "itt.hpp"
+
 #include <memory>
+#include <mutex>
 #include <utility>
+#include <vector>
 
 using namespace HeteroPlugin;
 using namespace InferenceEngine;
@@ -15,33 +19,94 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(const IInferRequestInternal::Pt
                                                  const ITaskExecutor::Ptr& callbackExecutor)
     : AsyncInferRequestThreadSafeDefault(request, taskExecutor, callbackExecutor),
       _heteroInferRequest(std::static_pointer_cast<HeteroInferRequest>(request)) {
-    _pipeline.clear();
-    for (std::size_t requestId = 0; requestId < _heteroInferRequest->_inferRequests.size(); ++requestId) {
-        struct RequestExecutor : ITaskExecutor {
-            explicit RequestExecutor(SoIInferRequestInternal& inferRequest) : _inferRequest(inferRequest) {
-                _inferRequest->SetCallback([this](std::exception_ptr exceptionPtr) mutable {
-                    _exceptionPtr = exceptionPtr;
-                    auto capturedTask = std::move(_task);
-                    capturedTask();
+    // Runs every sub-request as soon as all the sub-requests producing its inputs are finished, so independent
+    // subgraphs are executed concurrently. The stage task is called when all started sub-requests are finished.
+    struct SubgraphsExecutor : ITaskExecutor {
+        explicit SubgraphsExecutor(HeteroInferRequest::SubRequestsList& inferRequests)
+            : _inferRequests(inferRequests),
+              _dependents(inferRequests.size()),
+              _pendingInputs(inferRequests.size()) {
+            for (std::size_t requestId = 0; requestId < _inferRequests.size(); ++requestId) {
+                for (auto&& dependency : _inferRequests[requestId]._dependencies) {
+                    _dependents[dependency].push_back(requestId);
+                }
+                _inferRequests[requestId]._request->SetCallback([this, requestId](std::exception_ptr exceptionPtr) {
+                    OnRequestFinished(requestId, exceptionPtr);
                 });
             }
-            void run(Task task) override {
+        }
+
+        void run(Task task) override {
+            std::vector<std::size_t> readyRequests;
+            {
+                std::lock_guard<std::mutex> lock{_mutex};
                 _task = std::move(task);
-                _inferRequest->StartAsync();
-            };
-            SoIInferRequestInternal& _inferRequest;
-            std::exception_ptr _exceptionPtr;
-            Task _task;
-        };
+                _exceptionPtr = nullptr;
+                for (std::size_t requestId = 0; requestId < _inferRequests.size(); ++requestId) {
+                    _pendingInputs[requestId] = _inferRequests[requestId]._dependencies.size();
+                    if (_pendingInputs[requestId] == 0) {
+                        readyRequests.push_back(requestId);
+                    }
+                }
+                _running = readyRequests.size();
+            }
+            StartRequests(readyRequests);
+        }
 
-        auto requestExecutor =
-            std::make_shared<RequestExecutor>(_heteroInferRequest->_inferRequests[requestId]._request);
-        _pipeline.emplace_back(requestExecutor, [requestExecutor] {
-            if (nullptr != requestExecutor->_exceptionPtr) {
-                std::rethrow_exception(requestExecutor->_exceptionPtr);
+        void StartRequests(const std::vector<std::size_t>& requestIds) {
+            for (auto&& requestId : requestIds) {
+                try {
+                    OV_ITT_SCOPED_TASK(itt::domains::HeteroPlugin, _inferRequests[requestId]._profilingTask);
+                    _inferRequests[requestId]._request->StartAsync();
+                } catch (...) {
+                    OnRequestFinished(requestId, std::current_exception());
+                }
             }
-        });
-    }
+        }
+
+        void OnRequestFinished(std::size_t requestId, std::exception_ptr exceptionPtr) {
+            std::vector<std::size_t> readyRequests;
+            bool finished = false;
+            {
+                std::lock_guard<std::mutex> lock{_mutex};
+                if (nullptr != exceptionPtr && nullptr == _exceptionPtr) {
+                    _exceptionPtr = exceptionPtr;
+                }
+                // sub-requests depending on a failed one are not started
+                if (nullptr == _exceptionPtr) {
+                    for (auto&& dependent : _dependents[requestId]) {
+                        if (--_pendingInputs[dependent] == 0) {
+                            readyRequests.push_back(dependent);
+                        }
+                    }
+                }
+                _running += readyRequests.size();
+                finished = (--_running == 0);
+            }
+            if (finished) {
+                auto capturedTask = std::move(_task);
+                capturedTask();
+            } else {
+                StartRequests(readyRequests);
+            }
+        }
+
+        HeteroInferRequest::SubRequestsList& _inferRequests;
+        std::vector<std::vector<std::size_t>> _dependents;
+        std::vector<std::size_t> _pendingInputs;
+        std::size_t _running = 0;
+        std::mutex _mutex;
+        std::exception_ptr _exceptionPtr;
+        Task _task;
+    };
+
+    auto subgraphsExecutor = std::make_shared<SubgraphsExecutor>(_heteroInferRequest->_inferRequests);
+    _pipeline.clear();
+    _pipeline.emplace_back(subgraphsExecutor, [subgraphsExecutor] {
+        if (nullptr != subgraphsExecutor->_exceptionPtr) {
+            std::rethrow_exception(subgraphsExecutor->_exceptionPtr);
+        }
+    });
 }
 
 StatusCode HeteroAsyncInferRequest::Wait(int64_t millis_timeout) {
@@ -7,11 +7,13 @@
 #include <ie_blob.h>
 #include <ie_layouts.h>
 
+#include <algorithm>
 #include <cassert>
 #include <description_buffer.hpp>
 #include <ie_algorithm.hpp>
 #include <map>
 #include <string>
+#include <unordered_map>
 
 #include "itt.hpp"
 
@@ -45,7 +47,11 @@ void HeteroInferRequest::CreateInferRequest(
         IE_THROW() << "Internal error: no information about network's output/input";
     }
 
-    auto requestBlob([&](const std::string& blobName, InferenceEngine::SoIInferRequestInternal& r, bool output) {
+    // sub-request index by the name of an intermediate blob it produces
+    std::unordered_map<std::string, std::size_t> blobProducers;
+    auto requestBlob([&](const std::string& blobName, std::size_t requestId, bool output) {
+        auto& desc = _inferRequests[requestId];
+        auto& r = desc._request;
         std::string intermediateBlobName = blobName;
         auto itName = subgraphInputToOutputBlobNames.find(blobName);
         if (itName != subgraphInputToOutputBlobNames.end()) {
@@ -55,32 +61,39 @@ void HeteroInferRequest::CreateInferRequest(
             if (InferenceEngine::details::contains(_networkOutputs, blobName)) {
                 _subRequestFromBlobName.emplace(blobName, r);
             } else {
-                auto blob = r->GetBlob(blobName);
                 _blobs.emplace(intermediateBlobName, r->GetBlob(blobName));
+                blobProducers.emplace(intermediateBlobName, requestId);
             }
         } else {
             if (InferenceEngine::details::contains(_networkInputs, blobName)) {
                 _subRequestFromBlobName.emplace(blobName, r);
             } else {
                 r->SetBlob(blobName, _blobs.at(intermediateBlobName));
+                auto producer = blobProducers.at(intermediateBlobName);
+                if (std::find(desc._dependencies.begin(), desc._dependencies.end(), producer) ==
+                    desc._dependencies.end()) {
+                    desc._dependencies.push_back(producer);
+                }
             }
         }
     });
 
     // go over all subnet and create requests
-    for (auto&& desc : _inferRequests) {
+    for (std::size_t requestId = 0; requestId < _inferRequests.size(); ++requestId) {
+        auto& desc = _inferRequests[requestId];
         desc._request = {desc._network->CreateInferRequest(), desc._network._so};
         desc._request->setModelInputsOutputs(desc._network->getInputs(), desc._network->getOutputs());
+        desc._dependencies.clear();
         // go over all inputs and get blobs from subnet infer requests
         for (auto&& outputInfo : desc._network->GetOutputsInfo()) {
-            requestBlob(outputInfo.first, desc._request, true);
+            requestBlob(outputInfo.first, requestId, true);
         }
     }
 
     // go over all outputs and get blobs from subnet infer requests
-    for (auto&& desc : _inferRequests) {
-        for (auto&& inputInfo : desc._network->GetInputsInfo()) {
-            requestBlob(inputInfo.first, desc._request, false);
+    for (std::size_t requestId = 0; requestId < _inferRequests.size(); ++requestId) {
+        for (auto&& inputInfo : _inferRequests[requestId]._network->GetInputsInfo()) {
+            requestBlob(inputInfo.first, requestId, false);
         }
     }
 }
@@ -25,6 +25,8 @@ public:
         InferenceEngine::SoExecutableNetworkInternal _network;
         InferenceEngine::SoIInferRequestInternal _request;
         openvino::itt::handle_t _profilingTask;
+        // indices of sub-requests producing inputs of this sub-request
+        std::vector<std::size_t> _dependencies;
     };
     using SubRequestsList = std::vector<SubRequestDesc>;
 
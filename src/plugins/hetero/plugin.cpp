@@ -8,14 +8,17 @@
 #include <memory>
 #include <vector>
 #include <map>
+#include <set>
 #include <string>
 #include <utility>
 #include <fstream>
 #include <unordered_set>
+#include <unordered_map>
 #include "ie_plugin_config.hpp"
 #include "executable_network.hpp"
 #include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include <openvino/runtime/properties.hpp>
+#include <ngraph/op/util/op_types.hpp>
 // clang-format on
 
 using namespace InferenceEngine;
@@ -27,6 +30,7 @@ Engine::Engine() {
     _pluginName = "HETERO";
     _config[KEY_EXCLUSIVE_ASYNC_REQUESTS] = YES;
     _config[HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)] = NO;
+    _config[HETERO_CONFIG_KEY(MINIMIZE_TRANSFERS)] = NO;
 }
 
 namespace {
@@ -40,6 +44,7 @@ Engine::Configs mergeConfigs(Engine::Configs config, const Engine::Configs& loca
 
 const std::vector<std::string>& getSupportedConfigKeys() {
     static const std::vector<std::string> supported_configKeys = {HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+                                                                  HETERO_CONFIG_KEY(MINIMIZE_TRANSFERS),
                                                                   "TARGET_FALLBACK",
                                                                   ov::device::priorities.name(),
                                                                   CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)};
@@ -47,6 +52,111 @@ const std::vector<std::string>& getSupportedConfigKeys() {
     return supported_configKeys;
 }
 
+// Starts from the devices priority based layers assignment and moves layers supported by several devices while it
+// reduces the total size of tensors passed between devices.
+QueryNetworkResult MinimizeTransfers(const std::vector<std::shared_ptr<ngraph::Node>>& orderedOps,
+                                     const std::vector<std::pair<std::string, QueryNetworkResult>>& queryResults) {
+    QueryNetworkResult result;
+    auto& affinities = result.supportedLayersMap;
+    std::unordered_map<std::string, std::vector<std::string>> supportedDevices;
+    for (auto&& queryResult : queryResults) {
+        for (auto&& layer : queryResult.second.supportedLayersMap) {
+            affinities.emplace(layer);
+            supportedDevices[layer.first].push_back(layer.second);
+        }
+    }
+
+    // parameters, constants and results follow affinities of the connected layers
+    auto IsMovable = [](const ngraph::Node* node) {
+        return !ngraph::op::is_parameter(node) && !ngraph::op::is_constant(node) && !ngraph::op::is_output(node);
+    };
+    auto TensorSize = [](const ngraph::Output<ngraph::Node>& output) {
+        const auto& shape = output.get_partial_shape();
+        const auto elementSize = output.get_element_type().size();
+        return shape.is_static() ? elementSize * ngraph::shape_size(shape.to_shape()) : elementSize;
+    };
+    // Size of the output passed to every other device executing its consumers, the node is considered executed on
+    // the device
+    auto OutputTransfersSize = [&](const ngraph::Output<ngraph::Node>& output,
+                                   const ngraph::Node* node,
+                                   const std::string& device) -> std::size_t {
+        auto Affinity = [&](const ngraph::Node* other) -> const std::string* {
+            if (other == node) {
+                return &device;
+            }
+            auto itAffinity = affinities.find(other->get_friendly_name());
+            return itAffinity != affinities.end() ? &itAffinity->second : nullptr;
+        };
+        auto producerAffinity = Affinity(output.get_node());
+        if (!IsMovable(output.get_node()) || producerAffinity == nullptr) {
+            return 0;
+        }
+        std::unordered_set<std::string> consumerDevices;
+        for (auto&& targetInput : output.get_target_inputs()) {
+            auto consumerAffinity = Affinity(targetInput.get_node());
+            if (IsMovable(targetInput.get_node()) && consumerAffinity != nullptr &&
+                *consumerAffinity != *producerAffinity) {
+                consumerDevices.insert(*consumerAffinity);
+            }
+        }
+        return consumerDevices.size() * TensorSize(output);
+    };
+    // Size of the layer inputs and outputs passed between devices if the layer is executed on the device. Only these
+    // tensors depend on the layer affinity, so the difference of the sizes is the difference of the total transfers.
+    auto TransfersSize = [&](ngraph::Node* node, const std::string& device) {
+        std::set<ngraph::Output<ngraph::Node>> tensors;
+        for (auto&& input : node->inputs()) {
+            tensors.insert(input.get_source_output());
+        }
+        for (auto&& output : node->outputs()) {
+            tensors.insert(output);
+        }
+        std::size_t size = 0;
+        for (auto&& tensor : tensors) {
+            size += OutputTransfersSize(tensor, node, device);
+        }
+        return size;
+    };
+
+    constexpr std::size_t maxPasses = 8;
+    bool changed = true;
+    for (std::size_t pass = 0; changed && pass < maxPasses; ++pass) {
+        changed = false;
+        for (auto&& node : orderedOps) {
+            auto itDevices = supportedDevices.find(node->get_friendly_name());
+            if (!IsMovable(node.get()) || itDevices == supportedDevices.end() || itDevices->second.size() < 2) {
+                continue;
+            }
+            auto& affinity = affinities[node->get_friendly_name()];
+            auto minSize = TransfersSize(node.get(), affinity);
+            for (auto&& device : itDevices->second) {
+                auto size = TransfersSize(node.get(), device);
+                if (size < minSize) {
+                    minSize = size;
+                    affinity = device;
+                    changed = true;
+                }
+            }
+        }
+    }
+
+    for (auto&& node : orderedOps) {
+        if (!IsMovable(node.get())) {
+            const ngraph::Node* nodeWithAffinity = nullptr;
+            if (ngraph::op::is_output(node)) {
+                nodeWithAffinity = node->input_value(0).get_node();
+            } else if (!node->output(0).get_target_inputs().empty()) {
+                nodeWithAffinity = node->output(0).get_target_inputs().begin()->get_node();
+            }
+            auto itAffinity = nodeWithAffinity ? affinities.find(nodeWithAffinity->get_friendly_name()) : affinities.end();
+            if (itAffinity != affinities.end()) {
+                affinities[node->get_friendly_name()] = itAffinity->second;
+            }
+        }
+    }
+    return result;
+}
+
 }  // namespace
 
 InferenceEngine::IExecutableNetworkInternal::Ptr Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork& network,
@@ -116,9 +226,8 @@ void Engine::SetConfig(const Configs& configs) {
     }
 }
 
-QueryNetworkResult Engine::QueryNetwork(const CNNNetwork& network, const Configs& config) const {
-    QueryNetworkResult qr;
-
+std::vector<std::pair<std::string, QueryNetworkResult>> Engine::QueryDevices(const CNNNetwork& network,
+                                                                             const Configs& config) const {
     if (GetCore() == nullptr) {
         IE_THROW() << "Please, work with HETERO device via InferencEngine::Core object";
     }
@@ -149,9 +258,25 @@ QueryNetworkResult Engine::QueryNetwork(const CNNNetwork& network, const Configs
     //  WARNING: Here is devices with user set priority
     auto fallbackDevices = InferenceEngine::DeviceIDParser::getHeteroDevices(fallbackDevicesStr);
 
+    std::vector<std::pair<std::string, QueryNetworkResult>> devicesQueryResults;
     for (auto&& deviceName : fallbackDevices) {
-        for (auto&& layerQueryResult : queryResults[deviceName].supportedLayersMap) {
-            qr.supportedLayersMap.emplace(layerQueryResult);
+        devicesQueryResults.emplace_back(deviceName, queryResults[deviceName]);
+    }
+    return devicesQueryResults;
+}
+
+QueryNetworkResult Engine::QueryNetwork(const CNNNetwork& network, const Configs& config) const {
+    QueryNetworkResult qr;
+
+    auto tconfig = mergeConfigs(_config, config);
+    auto itMinimizeTransfers = tconfig.find(HETERO_CONFIG_KEY(MINIMIZE_TRANSFERS));
+    if (itMinimizeTransfers != tconfig.end() && itMinimizeTransfers->second == YES) {
+        qr = MinimizeTransfers(network.getFunction()->get_ordered_ops(), QueryDevices(network, config));
+    } else {
+        for (auto&& deviceQueryResult : QueryDevices(network, config)) {
+            for (auto&& layerQueryResult : deviceQueryResult.second.supportedLayersMap) {
+                qr.supportedLayersMap.emplace(layerQueryResult);
+            }
         }
     }
 
@@ -214,11 +339,11 @@ std::string Engine::DeviceArchitecture(const std::string& targetFallback) const
 }
 
 Parameter Engine::GetConfig(const std::string& name, const std::map<std::string, Parameter>& /*options*/) const {
-    if (name == HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)) {
-        auto it = _config.find(HETERO_CONFIG_KEY(DUMP_GRAPH_DOT));
+    if (name == HETERO_CONFIG_KEY(DUMP_GRAPH_DOT) || name == HETERO_CONFIG_KEY(MINIMIZE_TRANSFERS)) {
+        auto it = _config.find(name);
         IE_ASSERT(it != _config.end());
-        bool dump = it->second == YES;
-        return {dump};
+        bool value = it->second == YES;
+        return {value};
     } else if (name == "TARGET_FALLBACK" || name == ov::device::priorities.name()) {
         auto it = _config.find("TARGET_FALLBACK");
         if (it == _config.end()) {
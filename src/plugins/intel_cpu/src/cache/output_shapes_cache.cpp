@@ -0,0 +1,29 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "output_shapes_cache.h"
+
+#include <common/primitive_hashing_utils.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+size_t OutputShapesCache::Key::hash() const {
+    using namespace dnnl::impl;
+    using namespace dnnl::impl::primitive_hashing;
+
+    size_t seed = hash_combine(0, segmentStart);
+    for (const auto& d : dims) {
+        seed = hash_combine(seed, d.size());
+        seed = get_vector_hash(seed, d);
+    }
+    return seed;
+}
+
+bool OutputShapesCache::Key::operator==(const Key& rhs) const {
+    return segmentStart == rhs.segmentStart && dims == rhs.dims;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
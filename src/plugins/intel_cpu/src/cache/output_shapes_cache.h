@@ -0,0 +1,73 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "cpu_types.h"
+#include "lru_cache.h"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Keeps the output dims of the dynamic nodes of a graph segment for the shape signatures seen before.
+ * The graph is split into segments by the nodes whose output shapes depend on the data, so the shapes of a segment
+ * are defined by the dims of the graph inputs and the output dims of such nodes executed before the segment.
+ *
+ * @attention This cache IS NOT THREAD SAFE!
+ */
+class OutputShapesCache {
+public:
+    struct Key {
+        size_t segmentStart = 0;
+        // the dims of the graph inputs followed by the output dims of the data dependent nodes executed before the segment
+        std::vector<VectorDims> dims;
+
+        size_t hash() const;
+        bool operator==(const Key& rhs) const;
+    };
+
+    // The output dims of every node of the segment by the output port, empty for the static nodes.
+    using SegmentShapes = std::vector<std::vector<VectorDims>>;
+    using SegmentShapesPtr = std::shared_ptr<const SegmentShapes>;
+
+public:
+    explicit OutputShapesCache(size_t capacity) : _impl(capacity) {}
+
+    /**
+     * @brief Returns the shapes stored for the key or nullptr if there are no such.
+     */
+    SegmentShapesPtr get(const Key& key) {
+        auto shapes = _impl.get(key);
+        if (shapes) {
+            _hits++;
+        } else {
+            _misses++;
+        }
+        return shapes;
+    }
+
+    void put(const Key& key, const SegmentShapesPtr& shapes) {
+        _impl.put(key, shapes);
+    }
+
+    size_t hits() const {
+        return _hits;
+    }
+
+    size_t misses() const {
+        return _misses;
+    }
+
+private:
+    LruCache<Key, SegmentShapesPtr> _impl;
+    size_t _hits = 0;
+    size_t _misses = 0;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -149,6 +149,22 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             // any negative value will be treated
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
+        } else if (PluginConfigInternalParams::KEY_CPU_WORK_SIZE_AWARE_THREADING == key) {
+            if (val == PluginConfigParams::YES)
+                workSizeAwareThreading = true;
+            else if (val == PluginConfigParams::NO)
+                workSizeAwareThreading = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_WORK_SIZE_AWARE_THREADING
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_LAYOUT_OPTIMIZATION == key) {
+            if (val == PluginConfigParams::YES)
+                layoutOptimization = true;
+            else if (val == PluginConfigParams::NO)
+                layoutOptimization = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_LAYOUT_OPTIMIZATION
+                           << ". Expected only YES/NO";
         } else if (CPUConfigParams::KEY_CPU_DENORMALS_OPTIMIZATION == key) {
             if (val == PluginConfigParams::YES) {
                 denormalsOptMode = DenormalsOptMode::DO_On;
@@ -159,6 +175,19 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_DENORMALS_OPTIMIZATION
                 << ". Expected only YES/NO";
             }
+        } else if (CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE == key) {
+            float val_f = 0.0f;
+            try {
+                val_f = std::stof(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE
+                           << ". Expected only float numbers";
+            }
+            if (val_f < 0.0f || val_f > 1.0f) {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE
+                           << ". Sparse rate must be in range [0.0f,1.0f]";
+            }
+            fcSparseWeiDecompressionRate = val_f;
         } else {
             IE_THROW(NotFound) << "Unsupported property " << key << " by CPU plugin";
         }
@@ -35,6 +35,8 @@ struct Config {
     std::string dumpToDot = "";
     int batchLimit = 0;
     size_t rtCacheCapacity = 5000ul;
+    bool workSizeAwareThreading = false;
+    bool layoutOptimization = false;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
     InferenceEngine::PerfHintsConfig  perfHintsConfig;
 #if defined(__arm__) || defined(__aarch64__)
@@ -51,6 +53,9 @@ struct Config {
 
     DenormalsOptMode denormalsOptMode = DenormalsOptMode::DO_Keep;
 
+    // The minimal rate of zero weights that enables the sparse FullyConnected execution, 1 means disabled
+    float fcSparseWeiDecompressionRate = 1.0f;
+
     void readProperties(const std::map<std::string, std::string> &config);
     void updateProperties();
 
@@ -4,6 +4,7 @@
 
 #include <vector>
 #include <numeric>
+#include <algorithm>
 #include <unordered_set>
 
 #include <dnnl_types.h>
@@ -244,6 +245,48 @@ void DnnlMemoryMngr::notifyUpdate() {
             item->update();
         }
     }
+    for (auto& item : _partitions) {
+        if (auto partition = item.lock()) {
+            partition->notifyUpdate();
+        }
+    }
+}
+
+std::shared_ptr<DnnlMemoryMngr> DnnlMemoryMngr::createPartition(size_t totalChunks, size_t offsetChunk, size_t sizeChunk) {
+    if (sizeChunk == 0 || offsetChunk + sizeChunk > totalChunks) {
+        IE_THROW() << "Incorrect memory partition: offset " << offsetChunk << ", size " << sizeChunk << " of " << totalChunks << " chunks";
+    }
+
+    auto partition = std::make_shared<DnnlMemoryMngr>(
+        std::unique_ptr<PartitionedMemoryMngr>(new PartitionedMemoryMngr(shared_from_this(), totalChunks, offsetChunk, sizeChunk)));
+    _partitions.erase(std::remove_if(_partitions.begin(), _partitions.end(),
+                                     [](const std::weak_ptr<DnnlMemoryMngr>& item) { return item.expired(); }),
+                      _partitions.end());
+    _partitions.push_back(partition);
+    return partition;
+}
+
+void* PartitionedMemoryMngr::getRawPtr() const noexcept {
+    auto ptr = static_cast<uint8_t*>(_pParentMngr->getRawPtr());
+    if (!ptr)
+        return nullptr;
+    return ptr + _offsetChunk * (_size / _sizeChunk);
+}
+
+void PartitionedMemoryMngr::setExtBuff(void* ptr, size_t size) {
+    IE_THROW() << "Cannot set an external buffer to a memory partition";
+}
+
+bool PartitionedMemoryMngr::resize(size_t size) {
+    // the offset depends on the requested size, so the memory objects have to be updated even if the parent buffer is kept
+    const bool offsetChanged = _offsetChunk != 0 && size != _size;
+    _size = size;
+    const bool reallocated = _pParentMngr->resize(size / _sizeChunk * _totalChunks);
+    return reallocated || offsetChanged;
+}
+
+bool PartitionedMemoryMngr::hasExtBuffer() const noexcept {
+    return _pParentMngr->hasExtBuffer();
 }
 }   // namespace intel_cpu
 }   // namespace ov
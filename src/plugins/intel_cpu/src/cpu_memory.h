@@ -92,7 +92,7 @@ private:
 /**
  * @brief A proxy object that additionally implements observer pattern
  */
-class DnnlMemoryMngr : public IMemoryMngr {
+class DnnlMemoryMngr : public IMemoryMngr, public std::enable_shared_from_this<DnnlMemoryMngr> {
 public:
     explicit DnnlMemoryMngr(std::unique_ptr<IMemoryMngr> mngr) : _pMemMngr(std::move(mngr)) {}
     void* getRawPtr() const noexcept override;
@@ -102,17 +102,46 @@ public:
     void registerMemory(Memory* memPtr);
     void unregisterMemory(Memory* memPtr);
 
+    /**
+     * @brief Creates a manager of a contiguous part of this manager buffer (see PartitionedMemoryMngr).
+     * The memory objects of the partition are updated as well when this buffer is reallocated.
+     */
+    std::shared_ptr<DnnlMemoryMngr> createPartition(size_t totalChunks, size_t offsetChunk, size_t sizeChunk);
+
 private:
     void notifyUpdate();
 
 private:
     std::unordered_set<Memory*> _setMemPtrs;
+    std::vector<std::weak_ptr<DnnlMemoryMngr>> _partitions;
     std::unique_ptr<IMemoryMngr> _pMemMngr;
 };
 
 using DnnlMemoryMngrPtr = std::shared_ptr<DnnlMemoryMngr>;
 using DnnlMemoryMngrCPtr = std::shared_ptr<const DnnlMemoryMngr>;
 
+/**
+ * @brief A memory manager of the part of the parent manager buffer, which is split into totalChunks equal chunks along the outermost
+ * not unit dimension. The partition starts at offsetChunk chunk and occupies sizeChunk chunks. Since the chunk size is derived from
+ * the size requested for the partition, the offset is resolved at runtime, which allows dynamic tensors to be in place with each other.
+ */
+class PartitionedMemoryMngr : public IMemoryMngr {
+public:
+    PartitionedMemoryMngr(DnnlMemoryMngrPtr pParentMngr, size_t totalChunks, size_t offsetChunk, size_t sizeChunk)
+        : _pParentMngr(std::move(pParentMngr)), _totalChunks(totalChunks), _offsetChunk(offsetChunk), _sizeChunk(sizeChunk) {}
+    void* getRawPtr() const noexcept override;
+    void setExtBuff(void* ptr, size_t size) override;
+    bool resize(size_t size) override;
+    bool hasExtBuffer() const noexcept override;
+
+private:
+    DnnlMemoryMngrPtr _pParentMngr;
+    size_t _totalChunks;
+    size_t _offsetChunk;
+    size_t _sizeChunk;
+    size_t _size = 0ul;
+};
+
 class DnnlMemMngrHandle {
 public:
     DnnlMemMngrHandle(DnnlMemoryMngrPtr pMgr, Memory* pMem) : _pMgr(pMgr), _pMem(pMem) {
@@ -259,30 +259,27 @@ static inline bool isPhycicalMemCompatible(const MemoryDesc& lhsMemDesc, const M
     return true;
 }
 
-Edge::ReorderStatus Edge::needReorder() {
-    bool optimized = false;
-    auto inputPortDesc = getInputPortDesc();
-    auto outPortDesc = getOutputPortDesc();
+Edge::ReorderStatus Edge::needReorder(const PortDescBase& parentPortDesc, const PortDescBase& childPortDesc, bool isConstantParent) {
     // Check whether the child node may accept the parent produced tensor
-    if (!outPortDesc->isCompatible(*inputPortDesc)) {
-        // Performance optimization which exploit the fact that some tensors do not need actual data reordering to be read using different descriptors
-        if (isPhycicalMemCompatible(*inputPortDesc->getMemDesc(), *outPortDesc->getMemDesc()) && !getParent()->isConstant()) {
-            optimized = true;
-        } else {
-            return ReorderStatus::Regular;
-        }
-    }
+    if (childPortDesc.isCompatible(parentPortDesc))
+        return ReorderStatus::No;
+    // Performance optimization which exploit the fact that some tensors do not need actual data reordering to be read using different descriptors
+    if (isPhycicalMemCompatible(*parentPortDesc.getMemDesc(), *childPortDesc.getMemDesc()) && !isConstantParent)
+        return ReorderStatus::Optimized;
+    return ReorderStatus::Regular;
+}
+
+Edge::ReorderStatus Edge::needReorder() {
+    const auto status = needReorder(*getInputPortDesc(), *getOutputPortDesc(), getParent()->isConstant());
+    if (status == ReorderStatus::Regular)
+        return status;
 
     // put here as more costly than compatible check
     if (enforceReorder()) {
         return ReorderStatus::Regular;
     }
 
-    if (optimized) {
-        return ReorderStatus::Optimized;
-    }
-
-    return ReorderStatus::No;
+    return status;
 }
 
 void Edge::reuse(MemoryPtr ptr) {
@@ -64,6 +64,11 @@ public:
     MemoryPtr& getMemoryPtr();
 
     ReorderStatus needReorder();
+    /**
+     * @brief Checks whether the tensor produced with the parent port descriptor can be read with the child port
+     * descriptor, the in-place conflicts of the selected descriptors (see enforceReorder) are not taken into account
+     */
+    static ReorderStatus needReorder(const PortDescBase& parentPortDesc, const PortDescBase& childPortDesc, bool isConstantParent);
     bool isDropped() const;
     bool isUseExternalMemory() const;
 
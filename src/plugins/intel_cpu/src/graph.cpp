@@ -26,6 +26,7 @@
 #include <nodes/reorder.h>
 #include "nodes/convert.h"
 #include "nodes/subgraph.h"
+#include "nodes/fullyconnected.h"
 
 #include <ie_algorithm.hpp>
 #include <blob_factory.hpp>
@@ -34,6 +35,7 @@
 
 #include "precision_utils.h"
 #include <ie_plugin_config.hpp>
+#include <ie_parallel.hpp>
 
 #include "utils/general_utils.h"
 #include "utils/debug_capabilities.h"
@@ -63,6 +65,11 @@ using namespace InferenceEngine::details;
 namespace ov {
 namespace intel_cpu {
 
+namespace {
+// number of distinct input shapes signatures whose output shapes are kept by the graph
+constexpr size_t outputShapesCacheCapacity = 32;
+}   // namespace
+
 typedef std::unordered_set<EdgePtr> edge_cluster_t;
 typedef std::vector<edge_cluster_t> edge_clusters_t;
 
@@ -340,6 +347,13 @@ void Graph::Replicate(const CNNNetwork &network, const ExtensionManager::Ptr& ex
     if (config.enforceBF16)
         EnforceBF16();
 
+    if (config.fcSparseWeiDecompressionRate < 1.0f) {
+        for (auto &node : graphNodes) {
+            if (auto fcNode = std::dynamic_pointer_cast<node::FullyConnected>(node))
+                fcNode->setSparseWeightsDecompressionRate(config.fcSparseWeiDecompressionRate);
+        }
+    }
+
     auto hasSubgraphConsumers = [] (const NodePtr& node) -> bool {
         const auto & childEdges = node->getChildEdges();
         return std::any_of(childEdges.begin(), childEdges.end(),
@@ -402,6 +416,9 @@ void Graph::InitGraph() {
 
     InitDescriptors();
 
+    if (config.layoutOptimization)
+        OptimizeLayoutAssignment();
+
     InitOptimalPrimitiveDescriptors();
 
     InitEdges();
@@ -434,6 +451,15 @@ void Graph::InitGraph() {
         this->reuse_io_tensors = false;
     }
 
+    // Without states and inner bodies the output shapes of the graph segment are defined by the input shapes and the output shapes
+    // of the data dependent nodes executed before it, so the shape inference results may be reused when the same shapes come again.
+    if (haveDynNodes && config.rtCacheCapacity > 0 &&
+        std::none_of(graphNodes.begin(), graphNodes.end(), [](const NodePtr& node) {
+            return one_of(node->getType(), Type::MemoryInput, Type::MemoryOutput, Type::If, Type::TensorIterator);
+        })) {
+        outputShapesCache = std::make_shared<OutputShapesCache>(outputShapesCacheCapacity);
+    }
+
     Allocate();
 
     CreatePrimitives();
@@ -489,6 +515,137 @@ void Graph::InitDescriptors() {
     }
 }
 
+namespace {
+// Estimated cost of a reorder on the edge: amount of the memory moved or 0 if the layouts match
+size_t getReorderCost(const EdgePtr& edge, const NodeDesc* parentPd, const NodeDesc* childPd) {
+    if (parentPd == nullptr || childPd == nullptr)
+        return 0;
+    // reorders on constant paths are executed once on the load network stage
+    if (edge->getParent()->isConstant())
+        return 0;
+
+    // the ports are matched the same way as Edge::getInputPortDesc and Edge::getOutputPortDesc do
+    const auto& outConfs = parentPd->getConfig().outConfs;
+    const auto& inConfs = childPd->getConfig().inConfs;
+    int inNum = edge->getInputNum();
+    int outNum = edge->getOutputNum();
+    if (outConfs.empty() || inConfs.empty() || inNum < 0 || outNum < 0)
+        return 0;
+    if (inNum >= outConfs.size())
+        inNum = 0;
+    if (outNum >= inConfs.size())
+        outNum = 0;
+
+    const auto parentPortDesc = outConfs[inNum].getPortDesc();
+    const auto childPortDesc = inConfs[outNum].getPortDesc();
+    if (!parentPortDesc || !childPortDesc)
+        return 0;
+    // the same decision InitEdges makes, the optimized reorders do not move the data
+    if (Edge::needReorder(*parentPortDesc, *childPortDesc, false) != Edge::ReorderStatus::Regular)
+        return 0;
+
+    const auto parentDesc = parentPortDesc->getMemDesc();
+    const auto& shape = parentDesc->getShape();
+    // dynamic tensors are accounted as equal, since their sizes are not known at this stage
+    return shape.isStatic() ? shape.getElementsCount() * parentDesc->getPrecision().size() : 1;
+}
+
+bool hasInPlacePorts(const NodeDesc& pd) {
+    const auto& config = pd.getConfig();
+    auto isInPlace = [](const PortConfig& port) {
+        return port.inPlace() >= 0;
+    };
+    return std::any_of(config.inConfs.begin(), config.inConfs.end(), isInPlace) ||
+           std::any_of(config.outConfs.begin(), config.outConfs.end(), isInPlace);
+}
+
+// Cost of the reorders around the node if it used the primitive descriptor pd
+size_t getNodeReordersCost(const NodePtr& node, const NodeDesc& pd) {
+    size_t cost = 0;
+    for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+        const auto edge = node->getParentEdgeAt(i);
+        cost += getReorderCost(edge, edge->getParent()->getSelectedPrimitiveDescriptor(), &pd);
+    }
+    for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+        const auto edge = node->getChildEdgeAt(i);
+        cost += getReorderCost(edge, &pd, edge->getChild()->getSelectedPrimitiveDescriptor());
+    }
+    return cost;
+}
+}   // namespace
+
+/**
+ * Primitive descriptors are selected node by node and only the parents layouts are taken into account,
+ * so a node may produce a layout none of its consumers accepts. This pass iteratively revisits the choice
+ * of the nodes with layout-agnostic kernels among the descriptors of the same implementation type
+ * minimizing the estimated amount of the memory moved by the reorders around the node.
+ * The nodes which kernels performance depends on the layout (convolutions, poolings, etc.) are not revisited,
+ * since there is no kernel cost model to trade it for the saved reorders.
+ */
+void Graph::OptimizeLayoutAssignment() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::OptimizeLayoutAssignment");
+
+    auto isRefinable = [](const NodePtr& node) {
+        // the memory bound element-wise kernels process any layout at the same speed
+        if (!one_of(node->getType(), Type::Eltwise, Type::Subgraph, Type::Convert, Type::FakeQuantize, Type::Math))
+            return false;
+        const auto* selected = node->getSelectedPrimitiveDescriptor();
+        return selected != nullptr && node->getSupportedPrimitiveDescriptors().size() > 1 && !hasInPlacePorts(*selected);
+    };
+
+#ifdef CPU_DEBUG_CAPS
+    auto countReorders = [this]() {
+        size_t count = 0;
+        for (const auto& edge : graphEdges) {
+            if (getReorderCost(edge, edge->getParent()->getSelectedPrimitiveDescriptor(),
+                               edge->getChild()->getSelectedPrimitiveDescriptor()) > 0)
+                count++;
+        }
+        return count;
+    };
+    const size_t reordersBefore = countReorders();
+#endif
+
+    constexpr int maxIterations = 4;
+    for (int iteration = 0; iteration < maxIterations; iteration++) {
+        bool changed = false;
+        for (const auto& node : graphNodes) {
+            if (!isRefinable(node))
+                continue;
+
+            const auto& supportedPds = node->getSupportedPrimitiveDescriptors();
+            const auto* selected = node->getSelectedPrimitiveDescriptor();
+            const auto selectedImplType = selected->getImplementationType();
+
+            int bestIdx = static_cast<int>(selected - supportedPds.data());
+            size_t bestCost = getNodeReordersCost(node, *selected);
+            for (size_t i = 0; i < supportedPds.size() && bestCost > 0; i++) {
+                const auto& pd = supportedPds[i];
+                if (pd.getImplementationType() != selectedImplType || hasInPlacePorts(pd) ||
+                    pd.getConfig().inConfs.size() > node->getParentEdges().size())
+                    continue;
+                const size_t cost = getNodeReordersCost(node, pd);
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    bestIdx = static_cast<int>(i);
+                }
+            }
+
+            if (&supportedPds[bestIdx] != selected) {
+                DEBUG_LOG(node->getName(), " layout reassigned to pd[", bestIdx, "]");
+                node->selectPrimitiveDescriptorByIndex(bestIdx);
+                changed = true;
+            }
+        }
+        if (!changed)
+            break;
+    }
+
+#ifdef CPU_DEBUG_CAPS
+    DEBUG_LOG("Layout assignment: estimated reorders before ", reordersBefore, ", after ", countReorders());
+#endif
+}
+
 void Graph::InitOptimalPrimitiveDescriptors() {
     OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, "Graph::InitOptimalPrimitiveDescriptors");
     for (auto &node : graphNodes) {
@@ -905,6 +1062,8 @@ void Graph::CreatePrimitives() {
         OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, node->profiling.createPrimitive);
         DEBUG_LOG(*node);
         node->createPrimitive();
+        if (config.workSizeAwareThreading && !node->isDynamicNode() && node->isExecutable())
+            node->updateWorkThreads();
 #ifdef CPU_DEBUG_CAPS
         if (node->prim) {
             auto pd_c = (*node->prim).get_primitive_desc();
@@ -1078,9 +1237,62 @@ void Graph::InferStatic(InferRequestBase* request) {
     }
 }
 
+OutputShapesCache::Key Graph::getInputShapesKey() const {
+    OutputShapesCache::Key key;
+    key.dims.reserve(inputNodesMap.size());
+    for (const auto& input : inputNodesMap) {
+        const auto& childEdges = input.second->getChildEdgesAtPort(0);
+        if (childEdges.empty())
+            continue;
+        key.dims.push_back(childEdges[0]->getMemory().getStaticDims());
+    }
+    return key;
+}
+
+void Graph::appendOutputShapes(OutputShapesCache::Key& key, const NodePtr& node) const {
+    for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+        key.dims.push_back(node->getChildEdgeAt(i)->getMemory().getStaticDims());
+    }
+}
+
+OutputShapesCache::SegmentShapesPtr Graph::getSegmentShapes(size_t segmentStart, size_t segmentEnd) const {
+    auto shapes = std::make_shared<OutputShapesCache::SegmentShapes>(segmentEnd - segmentStart);
+    for (size_t i = segmentStart; i < segmentEnd; i++) {
+        const auto& node = executableGraphNodes[i];
+        // the shapes of the synchronization nodes are always inferred
+        if (!node->isDynamicNode() || syncNodesInds.count(node.get()))
+            continue;
+        auto& nodeShapes = (*shapes)[i - segmentStart];
+        for (size_t j = 0; j < node->getChildEdges().size(); j++) {
+            const auto edge = node->getChildEdgeAt(j);
+            const auto port = static_cast<size_t>(edge->getInputNum());
+            if (nodeShapes.size() <= port)
+                nodeShapes.resize(port + 1);
+            nodeShapes[port] = edge->getMemory().getStaticDims();
+        }
+    }
+    return shapes;
+}
+
 void Graph::InferDynamic(InferRequestBase* request) {
     dnnl::stream stream(eng);
 
+    OutputShapesCache::Key shapesKey;
+    OutputShapesCache::SegmentShapesPtr cachedShapes;
+    size_t segmentStart = 0;
+    if (outputShapesCache) {
+        shapesKey = getInputShapesKey();
+    }
+
+    auto updateNodeShapes = [&](size_t nodeIndx) {
+        const auto& node = executableGraphNodes[nodeIndx];
+        if (cachedShapes && !(*cachedShapes)[nodeIndx - segmentStart].empty()) {
+            node->redefineOutputMemory((*cachedShapes)[nodeIndx - segmentStart]);
+        } else {
+            node->updateShapes();
+        }
+    };
+
     std::set<size_t> syncIndsWorkSet;
     for (const auto& nodeIndx : syncNodesInds) {
         syncIndsWorkSet.insert(nodeIndx.second);
@@ -1111,7 +1323,7 @@ void Graph::InferDynamic(InferRequestBase* request) {
             return;
         }
         if (node->isDynamicNode()) {
-            node->updateShapes();
+            updateNodeShapes(node_indx);
         }
         if (--waveFrontCount[node_indx] == 0) {
             tg.run([=, &updateDynParams](){ updateDynParams(node_indx, stop_indx); });
@@ -1127,6 +1339,8 @@ void Graph::InferDynamic(InferRequestBase* request) {
         }
         if (node->isDynamicNode()) {
             node->updateDynamicParams();
+            if (config.workSizeAwareThreading)
+                node->updateWorkThreads();
         }
         if (node_indx + 1 < waveFrontCount.size() && --waveFrontCount[node_indx + 1] == 0) {
             tg.run([=, &updateDynParams](){ updateDynParams(node_indx + 1, stop_indx); });
@@ -1144,8 +1358,10 @@ void Graph::InferDynamic(InferRequestBase* request) {
         for (; prepareCounter < stopIndx; ++prepareCounter) {
             const auto& node = executableGraphNodes[prepareCounter];
             if (node->isDynamicNode()) {
-                node->updateShapes();
+                updateNodeShapes(prepareCounter);
                 node->updateDynamicParams();
+                if (config.workSizeAwareThreading)
+                    node->updateWorkThreads();
             }
         }
     };
@@ -1153,6 +1369,11 @@ void Graph::InferDynamic(InferRequestBase* request) {
     size_t inferCounter = 0;
 
     for (auto stopIndx : syncIndsWorkSet) {
+        segmentStart = inferCounter;
+        if (outputShapesCache && stopIndx > segmentStart) {
+            shapesKey.segmentStart = segmentStart;
+            cachedShapes = outputShapesCache->get(shapesKey);
+        }
         updateNodes(stopIndx);
         for (; inferCounter < stopIndx; ++inferCounter) {
             auto& node = executableGraphNodes[inferCounter];
@@ -1163,6 +1384,15 @@ void Graph::InferDynamic(InferRequestBase* request) {
                 request->ThrowIfCanceled();
             ExecuteNode(node, stream);
         }
+
+        if (outputShapesCache && stopIndx > segmentStart) {
+            if (!cachedShapes)
+                outputShapesCache->put(shapesKey, getSegmentShapes(segmentStart, stopIndx));
+            // the next segments depend on the output shapes of the executed synchronization node
+            const auto& node = executableGraphNodes[segmentStart];
+            if (stopIndx == segmentStart + 1 && syncNodesInds.count(node.get()))
+                appendOutputShapes(shapesKey, node);
+        }
     }
 }
 
@@ -1170,6 +1400,7 @@ inline void Graph::ExecuteNode(const NodePtr& node, const dnnl::stream& stream)
     DUMP(node, config, infer_count);
     OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, node->profiling.execute);
 
+    ParallelThreadsLimit threadsLimit(node->getWorkThreads());
     if (node->isDynamicNode()) {
         node->executeDynamic(stream);
     } else {
@@ -11,6 +11,7 @@
 #include "node.h"
 #include "edge.h"
 #include "cache/multi_cache.h"
+#include "cache/output_shapes_cache.h"
 #include "dnnl_scratch_pad.h"
 #include <map>
 #include <string>
@@ -208,6 +209,7 @@ protected:
         graphEdges.clear();
         _normalizePreprocMap.clear();
         syncNodesInds.clear();
+        outputShapesCache.reset();
     }
     Status status { Status::NotReady };
     Config config;
@@ -236,6 +238,7 @@ protected:
     void InitGraph();
     void InitNodes();
     void InitDescriptors();
+    void OptimizeLayoutAssignment();
     void InitOptimalPrimitiveDescriptors();
     void InitEdges();
     void Allocate();
@@ -268,6 +271,14 @@ private:
     DnnlScratchPadPtr rtScratchPad;
     std::unordered_map<Node*, size_t> syncNodesInds;
 
+    // Allows to skip the dynamic nodes shape inference when a graph segment between the data dependent nodes is
+    // executed with an already seen shapes signature. Is created only for graphs without states and inner bodies.
+    std::shared_ptr<OutputShapesCache> outputShapesCache;
+
+    OutputShapesCache::Key getInputShapesKey() const;
+    void appendOutputShapes(OutputShapesCache::Key& key, const NodePtr& node) const;
+    OutputShapesCache::SegmentShapesPtr getSegmentShapes(size_t segmentStart, size_t segmentEnd) const;
+
     void EnforceBF16();
 };
 
@@ -488,8 +488,16 @@ void GraphOptimizer::MergeConvertAndScaleShift(Graph& graph) {
                parentNode->getOriginalOutputPrecisionAtPort(0) == Precision::FP32;
     };
 
-    auto isSuitableChildNode = [](NodePtr childNode) {
-        return childNode->getType() == Type::Eltwise && childNode->getParentEdges().size() != 2;
+    auto isSuitableChildNode = [](EdgePtr childEdge) {
+        auto childNode = childEdge->getChild();
+        if (childNode->getType() == Type::Eltwise)
+            return childNode->getParentEdges().size() != 2;
+        // Interpolate JIT kernels convert u8/i8 data while loading it, so the resize of the preprocessing
+        // reads the input image directly instead of its f32 copy
+        if (childNode->getType() != Type::Interpolate || childEdge->getOutputNum() != 0)
+            return false;
+        auto interpolateNode = dynamic_cast<Interpolate*>(childNode.get());
+        return interpolateNode && interpolateNode->canConvertInputWhileLoading();
     };
 
     auto parent = graphNodes.begin();
@@ -501,7 +509,7 @@ void GraphOptimizer::MergeConvertAndScaleShift(Graph& graph) {
         }
 
         auto childNode = parentNode->getChildEdgeAt(0)->getChild();
-        if (!isSuitableChildNode(childNode)) {
+        if (!isSuitableChildNode(parentNode->getChildEdgeAt(0))) {
             parent++;
             continue;
         }
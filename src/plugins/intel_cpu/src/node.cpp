@@ -347,10 +347,13 @@ void Node::resolveInPlaceEdges() {
     for (size_t i = 0; i < getChildEdges().size() && i < selected_pd->getConfig().outConfs.size(); i++) {
         auto childEdge = getChildEdgeAt(i);
 
-        if (childEdge->getStatus() != Edge::Status::NotAllocated || selected_pd->getConfig().outConfs[i].inPlace() < 0)
+        const auto inPlacePort = selected_pd->getConfig().outConfs[i].inPlace();
+        if (childEdge->getStatus() != Edge::Status::NotAllocated || inPlacePort < 0)
             continue;
 
-        auto memMgr = childEdge->getMemory().getDnnlMemoryMngr();
+        // the input may be a part of the base memory (e.g. an output of the in-place Split with dynamic shapes),
+        // so the memory manager is taken from the input rather than from the base edge
+        auto memMgr = getParentEdgesAtPort(inPlacePort)[0]->getMemory().getDnnlMemoryMngr();
         childEdge->getMemoryPtr().reset(new Memory(getEngine()));
         childEdge->getMemoryPtr()->Create(selected_pd->getConfig().outConfs[i].getMemDesc(), memMgr);
 
@@ -552,6 +555,38 @@ void Node::executeDynamic(dnnl::stream strm) {
     updateLastInputDims();
 }
 
+size_t Node::getWorkSize() const {
+    size_t workSize = 0;
+    auto addMemSize = [&workSize](const EdgePtr& edge) {
+        // the output shapes of data dependent nodes are not known before the execution
+        const auto size = edge->getMemory().getDesc().getCurrentMemSize();
+        if (size != MemoryDesc::UNDEFINED_SIZE)
+            workSize += size;
+    };
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        addMemSize(getParentEdgeAt(i));
+    }
+    for (size_t i = 0; i < outputShapes.size(); i++) {
+        const auto edges = getChildEdgesAtPort(i);
+        if (!edges.empty())
+            addMemSize(edges[0]);
+    }
+    return workSize;
+}
+
+void Node::updateWorkThreads() {
+    // below this amount of data per thread the fork/join overhead is comparable to the node execution time
+    constexpr size_t minWorkSizePerThread = 16 * 1024;
+
+    const size_t workSize = getWorkSize();
+    if (workSize == 0) {
+        workThreads = 0;
+        return;
+    }
+    const size_t threads = std::max<size_t>(workSize / minWorkSizePerThread, 1);
+    workThreads = static_cast<int>(std::min<size_t>(threads, std::numeric_limits<int>::max()));
+}
+
 bool Node::outputShapeDataDependency() const {
     auto port_mask = shapeInference->get_port_mask();
     if (EMPTY_PORT_MASK != port_mask) {
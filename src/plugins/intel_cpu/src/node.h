@@ -332,12 +332,25 @@ public:
 
     virtual void setDynamicBatchLim(int lim);
 
-    void resolveInPlaceEdges();
+    virtual void resolveInPlaceEdges();
 
     virtual void execute(dnnl::stream strm);
     void updateShapes();
     void updateDynamicParams();
     void executeDynamic(dnnl::stream strm);
+
+    /**
+     * @brief Updates the number of threads the node is executed on according to the estimated work size.
+     * Must be called when the node memory is allocated for the current shapes.
+     */
+    void updateWorkThreads();
+    /**
+     * @brief Returns the number of threads the node is executed on, 0 means all the stream threads
+     */
+    int getWorkThreads() const {
+        return workThreads;
+    }
+
     virtual void redefineOutputMemory(const std::vector<VectorDims> &newShapes);
     bool outputShapeDataDependency() const;
 
@@ -594,6 +607,12 @@ protected:
 
     virtual size_t getMaxBatch() const;
 
+    /**
+     * @brief Returns the estimated amount of data (in bytes) the node execution processes, which is the total
+     * size of the input and output memory by default. 0 means the work can not be estimated.
+     */
+    virtual size_t getWorkSize() const;
+
 
     virtual PortDescBasePtr getConsistentInputDesc(const NodeConfig &config, size_t idx) const;
     virtual PortDescBasePtr getConsistentOutputDesc(const NodeConfig &config, size_t idx) const;
@@ -750,6 +769,7 @@ private:
     std::string typeStr;
     Type type;
     int execIndex = -1;
+    int workThreads = 0;
 
     std::string typeToStr(Type type);
 
@@ -55,6 +55,40 @@ void convert_vec<float, ov::float16>(jit_generator & gen,
     gen.movdqu(gen.xword[dst], f16vec);
 }
 
+template <>
+void convert_vec<uint8_t, float>(jit_generator & gen,
+                                 const RegExp & src,
+                                 const RegExp & dst) {
+    auto const & f32vec = gen.ymm4;
+
+    gen.vpmovzxbd(f32vec, gen.qword[src]);
+    gen.vcvtdq2ps(f32vec, f32vec);
+    gen.vmovups(gen.yword[dst], f32vec);
+}
+
+template <>
+void convert_vec<int8_t, float>(jit_generator & gen,
+                                const RegExp & src,
+                                const RegExp & dst) {
+    auto const & f32vec = gen.ymm4;
+
+    gen.vpmovsxbd(f32vec, gen.qword[src]);
+    gen.vcvtdq2ps(f32vec, f32vec);
+    gen.vmovups(gen.yword[dst], f32vec);
+}
+
+template <>
+void convert_vec<ov::intel_cpu::bfloat16_t, float>(jit_generator & gen,
+                                                   const RegExp & src,
+                                                   const RegExp & dst) {
+    auto const & f32vec = gen.ymm4;
+
+    // bf16 is the upper half of fp32, so the conversion is exact
+    gen.vpmovzxwd(f32vec, gen.xword[src]);
+    gen.vpslld(f32vec, f32vec, 16);
+    gen.vmovups(gen.yword[dst], f32vec);
+}
+
 class jit_convert_array : public jit_kernel {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_convert_array)
 
@@ -89,14 +123,14 @@ class jit_convert_array : public jit_kernel {
             auto tail_size = var<size_t>();
 
             tail_size = size;
-            tail_size <<= static_cast<size_t>(std::logb(_src_size)) - 1;
-            copy<uint16_t>(tmp.pointer(), src, tail_size);
+            tail_size <<= static_cast<size_t>(std::logb(_src_size));
+            copy<uint8_t>(tmp.pointer(), src, tail_size);
 
             _convert_vec(*this, tmp.pointer(), tmp.pointer());
 
             tail_size = size;
-            tail_size <<= static_cast<size_t>(std::logb(_dst_size)) - 1;
-            copy<uint16_t>(dst, tmp.pointer(), tail_size);
+            tail_size <<= static_cast<size_t>(std::logb(_dst_size));
+            copy<uint8_t>(dst, tmp.pointer(), tail_size);
         });
 
         postamble();
@@ -125,8 +159,9 @@ public:
 
     template<typename src_t, typename dst_t>
     static fn_t get() {
+        const bool isF16 = std::is_same<src_t, ov::float16>::value || std::is_same<dst_t, ov::float16>::value;
         if (mayiuse(cpu_isa_t::avx2)
-            && dnnl::impl::cpu::x64::cpu().has(Xbyak::util::Cpu::tF16C)) {
+            && (!isF16 || dnnl::impl::cpu::x64::cpu().has(Xbyak::util::Cpu::tF16C))) {
             static jit_convert_array converter(convert_vec<src_t, dst_t>, sizeof(src_t), sizeof(dst_t));
             auto & generator = static_cast<jit_generator&>(converter);
             generator.create_kernel();
@@ -285,29 +320,103 @@ struct ConvertContext {
     }
 };
 
-template<typename T>
-struct ConvertPrecision;
+// Source types converted to fp32 exactly by jit_convert
+template <typename T>
+struct is_exact_jit_to_f32 : std::integral_constant<bool,
+                                 std::is_same<T, uint8_t>::value
+                                 || std::is_same<T, int8_t>::value
+                                 || std::is_same<T, ov::intel_cpu::bfloat16_t>::value> {};
+
+// Elements are converted by contiguous batches, so the inner loops are vectorized by the compiler
+constexpr size_t convert_batch = 64;
 
 template<typename src_t, typename dst_t>
-struct ConvertPrecision<std::tuple<src_t, dst_t>> {
-    void operator()(ConvertContext & ctx) {
-        auto src = static_cast<const src_t *>(ctx.srcPtr);
-        auto dst = static_cast<dst_t *>(ctx.dstPtr);
-        src_t lbound, ubound;
-        std::tie(lbound, ubound) = ctx.range<src_t>();
+void convert_batched(const src_t * src, dst_t * dst, size_t size, src_t lbound, src_t ubound, bool truncate) {
+    const size_t iterations = div_up(size, convert_batch);
+    if (truncate) {
+        parallel_for(iterations, [&](size_t i) {
+            const size_t offset = i * convert_batch;
+            const size_t current_batch_size = std::min(size - offset, convert_batch);
+            for (size_t j = offset; j < offset + current_batch_size; ++j)
+                dst[j] = static_cast<dst_t>(std::trunc(std::max(std::min(src[j], ubound), lbound)));
+        });
+    } else {
+        parallel_for(iterations, [&](size_t i) {
+            const size_t offset = i * convert_batch;
+            const size_t current_batch_size = std::min(size - offset, convert_batch);
+            for (size_t j = offset; j < offset + current_batch_size; ++j)
+                dst[j] = static_cast<dst_t>(std::max(std::min(src[j], ubound), lbound));
+        });
+    }
+}
 
-        if (std::is_integral<src_t>::value
-            || ctx.interimPrc.is_float()
-            || std::is_integral<dst_t>::value) {
-            parallel_for(ctx.size, [&](size_t i) {
-                dst[i] = static_cast<dst_t>(std::max(std::min(src[i], ubound), lbound));
-            });
+// src_t -> fp32 by jit_convert, then fp32 -> dst_t with the range clamping
+template<typename src_t, typename dst_t>
+void convert_via_f32(const src_t * src, dst_t * dst, size_t size, float lbound, float ubound, bool truncate) {
+    const size_t iterations = div_up(size, convert_batch);
+    typedef float batch_type[convert_batch];
+
+    parallel_for(iterations, [&](size_t i) {
+        batch_type tmp;
+        const size_t offset = i * convert_batch;
+        const size_t current_batch_size = std::min(size - offset, convert_batch);
+        jit_convert(src + offset, tmp, current_batch_size);         // src_t -> fp32
+        if (truncate) {
+            for (size_t j = 0; j < current_batch_size; ++j)         // fp32 -> dst_t
+                dst[offset + j] = static_cast<dst_t>(std::trunc(std::max(std::min(tmp[j], ubound), lbound)));
         } else {
-            parallel_for(ctx.size, [&](size_t i) {
-                dst[i] = static_cast<dst_t>(std::trunc(std::max(std::min(src[i], ubound), lbound)));
-            });
+            for (size_t j = 0; j < current_batch_size; ++j)         // fp32 -> dst_t
+                dst[offset + j] = static_cast<dst_t>(std::max(std::min(tmp[j], ubound), lbound));
         }
+    });
+}
+
+template<typename src_t, typename dst_t>
+void convert_impl(ConvertContext & ctx, std::false_type /* is_exact_jit_to_f32 */) {
+    auto src = static_cast<const src_t *>(ctx.srcPtr);
+    auto dst = static_cast<dst_t *>(ctx.dstPtr);
+    src_t lbound, ubound;
+    std::tie(lbound, ubound) = ctx.range<src_t>();
+
+    const bool truncate = !(std::is_integral<src_t>::value
+                            || ctx.interimPrc.is_float()
+                            || std::is_integral<dst_t>::value);
+    convert_batched(src, dst, ctx.size, lbound, ubound, truncate);
+}
 
+template<typename src_t, typename dst_t>
+void convert_impl(ConvertContext & ctx, std::true_type /* is_exact_jit_to_f32 */) {
+    auto src = static_cast<const src_t *>(ctx.srcPtr);
+
+    // The whole range of the source type is representable in fp32, so the clamping is not needed
+    if (std::is_same<dst_t, float>::value && ctx.interimPrc.is_float()) {
+        auto dst = static_cast<float *>(ctx.dstPtr);
+        const size_t iterations = div_up(ctx.size, convert_batch);
+        parallel_for(iterations, [&](size_t i) {
+            const size_t offset = i * convert_batch;
+            const size_t current_batch_size = std::min(ctx.size - offset, convert_batch);
+            jit_convert(src + offset, dst + offset, current_batch_size);
+        });
+        return;
+    }
+
+    auto dst = static_cast<dst_t *>(ctx.dstPtr);
+    float lbound, ubound;
+    std::tie(lbound, ubound) = ctx.range<src_t>();
+
+    const bool truncate = !(std::is_integral<src_t>::value
+                            || ctx.interimPrc.is_float()
+                            || std::is_integral<dst_t>::value);
+    convert_via_f32(src, dst, ctx.size, lbound, ubound, truncate);
+}
+
+template<typename T>
+struct ConvertPrecision;
+
+template<typename src_t, typename dst_t>
+struct ConvertPrecision<std::tuple<src_t, dst_t>> {
+    void operator()(ConvertContext & ctx) {
+        convert_impl<src_t, dst_t>(ctx, is_exact_jit_to_f32<src_t>{});
         ctx.converted = true;
     }
 };
@@ -334,28 +443,6 @@ struct ConvertPrecision<std::tuple<float, ov::intel_cpu::bfloat16_t>> {
     }
 };
 
-template<>
-struct ConvertPrecision<std::tuple<ov::intel_cpu::bfloat16_t, float>> {
-    void operator()(ConvertContext & ctx) {
-        auto src = static_cast<const ov::intel_cpu::bfloat16_t *>(ctx.srcPtr);
-        auto dst = static_cast<float *>(ctx.dstPtr);
-
-        if (ctx.interimPrc.is_float()) {
-            parallel_for(ctx.size, [&](size_t i) {
-                dst[i] = static_cast<float>(src[i]);
-            });
-        } else {
-            float lbound, ubound;
-            std::tie(lbound, ubound) = ctx.range<ov::intel_cpu::bfloat16_t>();
-            parallel_for(ctx.size, [&](size_t i) {
-                dst[i] = std::trunc(std::max(std::min(static_cast<float>(src[i]), ubound), lbound));
-            });
-        }
-
-        ctx.converted = true;
-    }
-};
-
 template<typename src_t>
 struct ConvertPrecision<std::tuple<src_t, ov::float16>> {
     void operator()(ConvertContext & ctx) {
@@ -87,11 +87,18 @@ void Concat::getSupportedDescriptors() {
     }
 
     // we need the first dims before axis to be 1 to avoid the reorder in the edge between the first parent and this concat
-    // TODO [DS]: inplace
-    if (!isDynamicNode()) {
-        const auto& childDims = outputShapes[0].getStaticDims();
-        if (std::all_of(childDims.begin(), childDims.begin() + axis, [](size_t dim) { return  dim == 1; }))
-            canBeInPlace = true;
+    const auto& childDims = outputShapes[0].getDims();
+    if (std::all_of(childDims.begin(), childDims.begin() + axis, [](size_t dim) { return  dim == 1; }))
+        canBeInPlace = true;
+
+    // with dynamic shapes the inputs are dense parts of the output, whose offsets are resolved at runtime by the memory partitions,
+    // so the concatenated dims have to be static
+    if (isDynamicNode() && canBeInPlace) {
+        canBeInPlace = childDims[axis] != Shape::UNDEFINED_DIM;
+        for (size_t i = 0; i < inputShapes.size() && canBeInPlace; i++) {
+            const auto partDim = inputShapes[i].getDims()[axis];
+            canBeInPlace = partDim != Shape::UNDEFINED_DIM && partDim != 0;
+        }
     }
 }
 
@@ -160,7 +167,6 @@ void Concat::initSupportedPrimitiveDescriptors() {
             config.inConfs[i].inPlace(-1);
             config.inConfs[i].constant(false);
             auto desc = itr->second->createSharedDesc(inputPrecision, getInputShapeAtPort(i));
-            // TODO [DS]: inplace
             if (isDynamicNode()) {
                 config.inConfs[i].setMemDesc(desc);
             } else {
@@ -180,10 +186,24 @@ void Concat::initSupportedPrimitiveDescriptors() {
         }
     }
 
-    // TODO [DS]: inplace
     if (!canBeInPlace || std::any_of(inputShapes.begin(), inputShapes.end(), [](const Shape& shape) { return shape.hasZeroDims(); }))
         return;
 
+    if (isDynamicNode()) {
+        for (auto refPdIndex : pdIndexesToReuse) {
+            const auto& refConfig = supportedPrimitiveDescriptors[refPdIndex].getConfig();
+            if (!refConfig.outConfs[0].getMemDesc()->hasLayoutType(LayoutType::ncsp))
+                continue;
+
+            auto config = refConfig;
+            for (size_t i = 0; i < getParentEdges().size(); i++) {
+                config.inConfs[i].inPlace(0);
+            }
+            supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown);
+        }
+        return;
+    }
+
     // Optimized inplace case
     for (auto refPdIndex : pdIndexesToReuse) {
         const auto& refConfig = supportedPrimitiveDescriptors[refPdIndex].getConfig();
@@ -234,6 +254,25 @@ void Concat::selectOptimalPrimitiveDescriptor() {
         }
     }
 
+    // With dynamic shapes the input memory partitions are created when the edges are resolved, so the parent outputs must not be
+    // shared with other consumers or with the parent inputs (e.g. by another optimized Concat), which are resolved to the whole output
+    if (isDynamicNode()) {
+        for (size_t i = 0; i < getParentEdges().size() && canBeInPlace; i++) {
+            const auto parentEdge = getParentEdgeAt(i);
+            const auto parent = parentEdge->getParent();
+            if (parent->getChildEdgesAtPort(parentEdge->getInputNum()).size() > 1) {
+                canBeInPlace = false;
+                break;
+            }
+            auto parentSpd = parent->getSelectedPrimitiveDescriptor();
+            if (parentSpd == nullptr)
+                continue;
+            const auto& parentInConfs = parentSpd->getConfig().inConfs;
+            if (std::any_of(parentInConfs.begin(), parentInConfs.end(), [](const PortConfig& conf) { return conf.inPlace() >= 0; }))
+                canBeInPlace = false;
+        }
+    }
+
     std::map<LayoutType, size_t> formatFrequency;
     std::vector<LayoutType> supportedLayouts = {LayoutType::ncsp, LayoutType::nspc, LayoutType::nCsp8c, LayoutType::nCsp16c};
     for (size_t i = 0; i < getParentEdges().size(); i++) {
@@ -338,6 +377,30 @@ void Concat::selectOptimalPrimitiveDescriptor() {
     selectPrimitiveDescriptorByIndex(0);
 }
 
+void Concat::resolveInPlaceEdges() {
+    if (!isDynamicNode() || !isOptimized()) {
+        Node::resolveInPlaceEdges();
+        return;
+    }
+
+    const auto& config = getSelectedPrimitiveDescriptor()->getConfig();
+    auto baseMemMngr = getChildEdgesAtPort(0)[0]->getMemory().getDnnlMemoryMngr();
+    const size_t totalChunks = getOutputShapeAtPort(0).getDims()[axis];
+    size_t offsetChunk = 0;
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        auto parentEdge = getParentEdgesAtPort(i)[0];
+        if (parentEdge->getStatus() != Edge::Status::NotAllocated)
+            IE_THROW() << "Concat node with name '" << getName() << "' has unexpectedly allocated input memory at port " << i;
+
+        const size_t sizeChunk = getInputShapeAtPort(i).getDims()[axis];
+        auto memMngr = baseMemMngr->createPartition(totalChunks, offsetChunk, sizeChunk);
+        parentEdge->getMemoryPtr().reset(new Memory(getEngine()));
+        parentEdge->getMemoryPtr()->Create(config.inConfs[i].getMemDesc(), memMngr);
+        parentEdge->changeStatus(Edge::Status::Allocated);
+        offsetChunk += sizeChunk;
+    }
+}
+
 bool Concat::created() const {
     return getType() == Type::Concatenation;
 }
@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <numeric>
 #include <string>
 #include <vector>
 #include <mutex>
@@ -10,6 +12,7 @@
 #include <ngraph/op/detection_output.hpp>
 #include "ie_parallel.hpp"
 #include "detection_output.h"
+#include "non_max_suppression.h"
 
 using namespace dnnl;
 using namespace InferenceEngine;
@@ -152,6 +155,19 @@ void DetectionOutput::initSupportedPrimitiveDescriptors() {
                          impl_desc_type::ref_any);
 }
 
+void DetectionOutput::createPrimitive() {
+    // the kernel is shape agnostic, so it is created once
+    if (!nmsKernel && !decreaseClassId && NMSThreshold >= 0.f) {
+        auto jcp = jit_nms_config_params();
+        jcp.box_encode_type = NMSBoxEncodeType::CORNER;
+        jcp.is_soft_suppressed_by_iou = false;
+        jcp.is_iou_threshold_strict = true;
+        nmsKernel = createNmsKernel(jcp);
+    }
+
+    Node::createPrimitive();
+}
+
 struct ConfidenceComparatorDO {
     explicit ConfidenceComparatorDO(const float* confDataIn) : confData(confDataIn) {}
 
@@ -265,30 +281,30 @@ void DetectionOutput::execute(dnnl::stream strm) {
     }
 
     // NMS
-    for (int n = 0; n < imgNum; ++n) {
-        if (!decreaseClassId) {
-            // Caffe style
-            parallel_for(classesNum, [&](int c) {
-                if (c != backgroundClassId) {  // Ignore background class
-                    int *pindices    = indicesData + n * classesNum * priorsNum + c * priorsNum;
-                    int *pbuffer     = indicesBufData + n * classesNum * priorsNum + c * priorsNum;
-                    int *pdetections = detectionsData + n * classesNum + c;
-
-                    const float *pboxes;
-                    const float *psizes;
-                    if (isShareLoc) {
-                        pboxes = decodedBboxesData + n * 4 * priorsNum;
-                        psizes = bboxSizesData + n * priorsNum;
-                    } else {
-                        pboxes = decodedBboxesData + n * 4 * classesNum * priorsNum + c * 4 * priorsNum;
-                        psizes = bboxSizesData + n * classesNum * priorsNum + c * priorsNum;
-                    }
-
-                    NMSCF(pbuffer, *pdetections, pindices, pboxes, psizes);
+    if (!decreaseClassId) {
+        // Caffe style
+        parallel_for2d(imgNum, classesNum, [&](int n, int c) {
+            if (c != backgroundClassId) {  // Ignore background class
+                int *pindices    = indicesData + n * classesNum * priorsNum + c * priorsNum;
+                int *pbuffer     = indicesBufData + n * classesNum * priorsNum + c * priorsNum;
+                int *pdetections = detectionsData + n * classesNum + c;
+
+                const float *pboxes;
+                const float *psizes;
+                if (isShareLoc) {
+                    pboxes = decodedBboxesData + n * 4 * priorsNum;
+                    psizes = bboxSizesData + n * priorsNum;
+                } else {
+                    pboxes = decodedBboxesData + n * 4 * classesNum * priorsNum + c * 4 * priorsNum;
+                    psizes = bboxSizesData + n * classesNum * priorsNum + c * priorsNum;
                 }
-            });
-        } else {
-            // MXNet style
+
+                NMSCF(pbuffer, *pdetections, pindices, pboxes, psizes);
+            }
+        });
+    } else {
+        // MXNet style
+        parallel_for(imgNum, [&](int n) {
             int *pbuffer = indicesBufData + n * classesNum * priorsNum;
             int *pdetections = detectionsData + n * classesNum;
             int *pindices = indicesData + n * classesNum * priorsNum;
@@ -296,48 +312,45 @@ void DetectionOutput::execute(dnnl::stream strm) {
             const float *psizes = bboxSizesData + n * locNumForClasses * priorsNum;
 
             NMSMX(pbuffer, pdetections, pindices, pboxes, psizes);
-        }
-
-        int detectionsTotal = 0;
-        detectionsTotal = parallel_sum(classesNum, detectionsTotal, [&](size_t c)->int {
-            return detectionsData[n * classesNum + c];
         });
+    }
 
-        // combine detections of all class for this image and filter with global(image) topk(keep_topk)
-        if (keepTopK > -1 && detectionsTotal > keepTopK) {
-            std::vector<std::pair<float, std::pair<int, int>>> confIndicesClassMap;
+    // combine detections of all class for every image and filter with global(image) topk(keep_topk)
+    parallel_for(imgNum, [&](int n) {
+        int detectionsTotal = std::accumulate(detectionsData + n * classesNum, detectionsData + (n + 1) * classesNum, 0);
+        if (keepTopK <= -1 || detectionsTotal <= keepTopK)
+            return;
 
-            std::mutex mtx;
-            parallel_for(classesNum, [&](int c) {
-                int detections = detectionsData[n * classesNum + c];
-                int *pindices = indicesData + n * classesNum * priorsNum + c * priorsNum;
+        std::vector<std::pair<float, std::pair<int, int>>> confIndicesClassMap;
+        confIndicesClassMap.reserve(detectionsTotal);
+        for (int c = 0; c < classesNum; ++c) {
+            int detections = detectionsData[n * classesNum + c];
+            int *pindices = indicesData + n * classesNum * priorsNum + c * priorsNum;
 
-                float *pconf  = reorderedConfData + n * classesNum * confInfoLen + c * confInfoLen;
+            float *pconf  = reorderedConfData + n * classesNum * confInfoLen + c * confInfoLen;
 
-                for (int i = 0; i < detections; ++i) {
-                    int pr = pindices[i];
-                    mtx.lock();
-                    confIndicesClassMap.push_back(std::make_pair(pconf[pr], std::make_pair(c, pr)));
-                    mtx.unlock();
-                }
-            });
+            for (int i = 0; i < detections; ++i) {
+                int pr = pindices[i];
+                confIndicesClassMap.push_back(std::make_pair(pconf[pr], std::make_pair(c, pr)));
+            }
+        }
 
-            std::sort(confIndicesClassMap.begin(), confIndicesClassMap.end(),
-                      SortScorePairDescend<std::pair<int, int>>);
-            confIndicesClassMap.resize(keepTopK);
+        // only keepTopK detections are needed in the order of confidence
+        std::partial_sort(confIndicesClassMap.begin(), confIndicesClassMap.begin() + keepTopK, confIndicesClassMap.end(),
+                          SortScorePairDescend<std::pair<int, int>>);
+        confIndicesClassMap.resize(keepTopK);
 
-            // Store the new indices. Assign to class back
-            memset(detectionsData + n * classesNum, 0, classesNum * sizeof(int));
+        // Store the new indices. Assign to class back
+        memset(detectionsData + n * classesNum, 0, classesNum * sizeof(int));
 
-            for (size_t j = 0; j < confIndicesClassMap.size(); ++j) {
-                int cls = confIndicesClassMap[j].second.first;
-                int pr = confIndicesClassMap[j].second.second;
-                int *pindices = indicesData + n * classesNum * priorsNum + cls * priorsNum;
-                pindices[detectionsData[n * classesNum + cls]] = pr;
-                detectionsData[n * classesNum + cls]++;
-            }
+        for (size_t j = 0; j < confIndicesClassMap.size(); ++j) {
+            int cls = confIndicesClassMap[j].second.first;
+            int pr = confIndicesClassMap[j].second.second;
+            int *pindices = indicesData + n * classesNum * priorsNum + cls * priorsNum;
+            pindices[detectionsData[n * classesNum + cls]] = pr;
+            detectionsData[n * classesNum + cls]++;
         }
-    }
+    });
 
     // get final output
     generateOutput(reorderedConfData, indicesData, detectionsData, decodedBboxesData, dstData);
@@ -770,6 +783,45 @@ inline void DetectionOutput::NMSCF(int* indicesIn,
     // nms for this class
     int countIn = detections;
     detections = 0;
+
+    // The kernel normalizes the corners of the boxes, so it is applied only if they are already ordered
+    bool isKernelApplicable = nmsKernel && countIn > 1;
+    for (int i = 0; i < countIn && isKernelApplicable; ++i) {
+        const float *box = bboxes + indicesIn[i] * 4;
+        isKernelApplicable = box[0] <= box[2] && box[1] <= box[3];
+    }
+    if (isKernelApplicable) {
+        // kept boxes are stored per coordinate, so iou with a vector of them is computed at once
+        std::vector<float> keptCoords(4 * countIn);
+        const float noScale = 0.f;
+        float score = 0.f;
+
+        auto arg = jit_nms_args();
+        arg.iou_threshold = &NMSThreshold;
+        arg.score_threshold = &noScale;
+        arg.scale = &noScale;
+        arg.score = &score;
+        for (int i = 0; i < 4; ++i)
+            arg.selected_boxes_coord[i] = keptCoords.data() + i * countIn;
+
+        for (int i = 0; i < countIn; ++i) {
+            const int prior = indicesIn[i];
+            int status = NMSCandidateStatus::SELECTED;
+            arg.selected_boxes_num = detections;
+            arg.candidate_box = bboxes + prior * 4;
+            arg.candidate_status = &status;
+            (*nmsKernel)(&arg);
+
+            if (status == NMSCandidateStatus::SELECTED) {
+                for (int k = 0; k < 4; ++k)
+                    keptCoords[k * countIn + detections] = bboxes[prior * 4 + k];
+                indicesOut[detections] = prior;
+                detections++;
+            }
+        }
+        return;
+    }
+
     for (int i = 0; i < countIn; ++i) {
         const int prior = indicesIn[i];
 
@@ -12,12 +12,15 @@ namespace ov {
 namespace intel_cpu {
 namespace node {
 
+struct jit_uni_nms_kernel;
+
 class DetectionOutput : public Node {
 public:
     DetectionOutput(const std::shared_ptr<ov::Node>& op, const dnnl::engine& eng, WeightsSharing::Ptr &cache);
 
     void getSupportedDescriptors() override {};
     void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
     void execute(dnnl::stream strm) override;
     bool created() const override;
 
@@ -107,6 +110,9 @@ private:
     std::vector<int> numPriorsActual;
     std::vector<int> confInfoForPrior;
 
+    // computes iou of the candidate with a vector of the kept boxes in Caffe style NMS
+    std::shared_ptr<jit_uni_nms_kernel> nmsKernel;
+
     std::string errorPrefix;
 };
 
@@ -50,6 +50,8 @@ void EmbeddingBagOffsetSum::initSupportedPrimitiveDescriptors() {
             {Precision::FP32, Precision::I8, Precision::U8, Precision::I32};
 
     auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
+    // bf16 table is read as is and accumulated in fp32 instead of converting the whole table
+    const bool bf16Table = inDataPrecision == Precision::BF16 && isBf16TableSupported();
     if (inDataPrecision == Precision::BF16)
         inDataPrecision = Precision::FP32;
     if (!supportedPrecisions.empty()) {
@@ -62,7 +64,7 @@ void EmbeddingBagOffsetSum::initSupportedPrimitiveDescriptors() {
             IE_THROW() << logPrefix << "has unsupported precision: " << inDataPrecision.name();
     }
 
-    std::vector<PortConfigurator> inDataConfigurators({{LayoutType::ncsp, inDataPrecision},
+    std::vector<PortConfigurator> inDataConfigurators({{LayoutType::ncsp, bf16Table ? Precision::BF16 : inDataPrecision},
                                                        {LayoutType::ncsp, Precision::I32},
                                                        {LayoutType::ncsp, Precision::I32}});
     if (inputShapes.size() > DEFAULT_INDEX_IDX)
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <cmath>
 #include <vector>
 #include <string>
@@ -10,8 +11,11 @@
 #include "embedding_bag_sum.h"
 #include <ngraph/opsets/opset1.hpp>
 #include "common/cpu_memcpy.h"
+#include "kernels/embedding_bag_kernel.hpp"
+#include <utils/bfloat16.hpp>
 
 using namespace InferenceEngine;
+using namespace dnnl::impl::cpu::x64;
 
 namespace ov {
 namespace intel_cpu {
@@ -119,8 +123,121 @@ void EmbeddingBagSum::processData(const T* srcData, const T* weightsData,
     parallel_nt(0, threadBody);
 }
 
+bool EmbeddingBagSum::isBf16TableSupported() {
+    return mayiuse(avx2);
+}
+
+void EmbeddingBagSum::createKernels(const Precision &srcPrc) {
+    _kernels.clear();
+    _kernelsPrc = srcPrc;
+    for (size_t vecs = 1lu; vecs <= jit_emb_bag_kernel::max_vecs; vecs++) {
+        if (mayiuse(avx512_core)) {
+            _kernels.emplace_back(new jit_emb_bag_kernel_f32<avx512_core>(srcPrc, vecs));
+            _kernelsSimd = cpu_isa_traits<avx512_core>::vlen / sizeof(float);
+        } else if (mayiuse(avx2)) {
+            _kernels.emplace_back(new jit_emb_bag_kernel_f32<avx2>(srcPrc, vecs));
+            _kernelsSimd = cpu_isa_traits<avx2>::vlen / sizeof(float);
+        } else {
+            break;
+        }
+        _kernels.back()->create_ker();
+    }
+}
+
+void EmbeddingBagSum::processDataJit(const uint8_t* srcData, const float* weightsData, const Precision &srcPrc,
+                                     const InferenceEngine::SizeVector& inDataDims, const MemoryPtr& outMemory) {
+    std::string msgPrefix = std::string("Node EmbeddingBagSum with name '") + _layerName + "' ";
+
+    initFromInputs();
+
+    const size_t outputBagsNum = outMemory->GetShape().getStaticDims()[0];
+    auto *dstData = reinterpret_cast<float *>(outMemory->GetPtr());
+    const size_t srcTypeSize = srcPrc.size();
+    const size_t simd = _kernelsSimd;
+    const size_t blockLen = jit_emb_bag_kernel::max_vecs * simd;
+
+    // A few long bags can not load all the threads, so the embedding depth is split between the threads as well
+    size_t depthChunks = 1lu;
+    const size_t threadsNum = parallel_get_max_threads();
+    if (outputBagsNum > 0lu && outputBagsNum < threadsNum)
+        depthChunks = std::max(std::min(div_up(threadsNum, outputBagsNum), _embDepth / simd), size_t(1lu));
+    const size_t chunkLen = std::max(rnd_up(div_up(_embDepth, depthChunks), simd), simd);
+    depthChunks = std::max(div_up(_embDepth, chunkLen), size_t(1lu));
+
+    static const float noWeight = 1.f;
+
+    auto readSrc = [&](size_t i) -> float {
+        if (srcPrc == Precision::BF16)
+            return static_cast<float>(reinterpret_cast<const bfloat16_t*>(srcData)[i]);
+        return reinterpret_cast<const float*>(srcData)[i];
+    };
+
+    auto threadBody = [&](const int ithr, const int nthr) {
+        size_t start(0lu), end(0lu);
+        splitter(outputBagsNum * depthChunks, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        size_t indicesSize = 0lu;
+        const int* indices = nullptr;
+        int weightsIdx = 0lu;
+        bool withWeights = _withWeights;
+
+        for (size_t iwork = start; iwork < end; iwork++) {
+            const size_t obi = iwork / depthChunks;
+            const size_t depthStart = (iwork % depthChunks) * chunkLen;
+            const size_t depthEnd = std::min(depthStart + chunkLen, _embDepth);
+            float* dst = dstData + obi * _embDepth;
+            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+
+            if (indices == nullptr) {
+                std::fill(dst + depthStart, dst + depthEnd, 0.f);
+                continue;
+            }
+            withWeights = withWeights & _withWeights;
+
+            for (size_t inIdx = 0lu; inIdx < indicesSize; inIdx++) {
+                if (static_cast<size_t>(indices[inIdx]) >= inDataDims[0]) {
+                    IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
+                }
+            }
+
+            jit_emb_bag_call_args args;
+            args.indices = indices;
+            args.weights = withWeights ? weightsData + weightsIdx : &noWeight;
+            args.row_stride = _embDepth * srcTypeSize;
+            args.weights_stride = withWeights ? sizeof(float) : 0lu;
+            args.num_indices = indicesSize;
+
+            size_t d = depthStart;
+            while (d + simd <= depthEnd) {
+                const size_t vecs = std::min(blockLen, depthEnd - d) / simd;
+                args.table = srcData + d * srcTypeSize;
+                args.dst = dst + d;
+                (*_kernels[vecs - 1])(&args);
+                d += vecs * simd;
+            }
+            for (; d < depthEnd; d++) {
+                float sum = 0.f;
+                for (size_t inIdx = 0lu; inIdx < indicesSize; inIdx++)
+                    sum += readSrc(indices[inIdx] * _embDepth + d) * (withWeights ? weightsData[weightsIdx + inIdx] : 1.f);
+                dst[d] = sum;
+            }
+        }
+    };
+
+    parallel_nt(0, threadBody);
+}
+
 void EmbeddingBagSum::execute(const uint8_t* srcData, const uint8_t* weightsData, const InferenceEngine::Precision &srcPrc,
                               const InferenceEngine::SizeVector& inDims, const MemoryPtr& outMemory) {
+    if (one_of(srcPrc, Precision::FP32, Precision::BF16)) {
+        if (_kernels.empty() || _kernelsPrc != srcPrc)
+            createKernels(srcPrc);
+        if (!_kernels.empty())
+            return processDataJit(srcData, reinterpret_cast<const float*>(weightsData), srcPrc, inDims, outMemory);
+    }
+
     switch (srcPrc) {
         case Precision::FP32: {
             return processData<PrecisionTrait<Precision::FP32>::value_type>(reinterpret_cast<const float*>(srcData),
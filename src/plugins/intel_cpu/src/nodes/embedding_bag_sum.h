@@ -12,6 +12,9 @@
 
 namespace ov {
 namespace intel_cpu {
+
+struct jit_emb_bag_kernel;
+
 namespace node {
 
 class EmbeddingBagSum {
@@ -28,6 +31,9 @@ public:
 
     ~EmbeddingBagSum() = default;
 
+    // Returns true if the embedding table may be stored in bf16, so it is read without conversion to f32
+    static bool isBf16TableSupported();
+
 protected:
     virtual void initFromInputs() = 0;
     virtual void getIndices(
@@ -42,6 +48,9 @@ protected:
     template<typename T>
     void processData(const T* srcData, const T* weightsData,
                      const InferenceEngine::SizeVector& inDataDims, const MemoryPtr& outMemory);
+    void processDataJit(const uint8_t* srcData, const float* weightsData, const InferenceEngine::Precision &srcPrc,
+                        const InferenceEngine::SizeVector& inDataDims, const MemoryPtr& outMemory);
+    void createKernels(const InferenceEngine::Precision &srcPrc);
 
     const size_t EMB_TABLE_IDX = 0lu;
     const size_t INDICES_IDX;
@@ -51,6 +60,11 @@ protected:
     bool _withWeights = false;
     size_t _embDepth = 0;
     std::string _layerName;
+
+    // kernels accumulating columns blocks of 1..max_vecs vector registers width
+    std::vector<std::shared_ptr<jit_emb_bag_kernel>> _kernels;
+    InferenceEngine::Precision _kernelsPrc;
+    size_t _kernelsSimd = 0;
 };
 
 }   // namespace node
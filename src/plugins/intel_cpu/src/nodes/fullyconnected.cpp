@@ -22,6 +22,9 @@
 #include <common/primitive_desc.hpp>
 #include <common/primitive_desc_iface.hpp>
 #include "onednn/dnnl.h"
+#include "common/cpu_memcpy.h"
+#include <ie_parallel.hpp>
+#include <numeric>
 
 using namespace dnnl;
 using namespace InferenceEngine;
@@ -200,6 +203,8 @@ void FullyConnected::getSupportedDescriptors() {
         outputDataType = memory::data_type::bf16;
     }
 
+    useSparseWeights = useSparseWeightsDecompression();
+
     inDims = isDynamicNode() ? makeDummyInputDims() : getInputShapeAtPort(DATA_ID).getStaticDims();
     outDims = isDynamicNode() ? makeDummyOutputDims(inDims) : getOutputShapeAtPort(0).getStaticDims();
 
@@ -229,6 +234,16 @@ void FullyConnected::prepareParams() {
     if (selected_pd == nullptr)
         IE_THROW() << "Preferable primitive descriptor is not set for node " << getName() << ".";
 
+    if (useSparseWeights) {
+        // the layouts are known only after the graph edges are initialized, so the check is postponed till here
+        useSparseWeights = canBeExecutedSparse();
+        if (useSparseWeights) {
+            prepareSparseParams();
+            selected_pd->setImplementationType(sparseBlockSize == 16 ? jit_avx512_sparse : jit_avx2_sparse);
+            return;
+        }
+    }
+
     AttrPtr attr = std::make_shared<dnnl::primitive_attr>();
     setPostOps(*attr, dstMemPtr->getStaticDims());
     (*attr).set_scratchpad_mode(dnnl::scratchpad_mode::user);
@@ -383,6 +398,11 @@ void FullyConnected::prepareParams() {
 }
 
 void FullyConnected::setDynamicBatchLim(int lim) {
+    if (useSparseWeights) {
+        dynBatchLim = lim;
+        return;
+    }
+
     if (!execPtr) {
         IE_THROW() << "Can't set dynamic batch for FullyConnected node with name: " << getName() << ", because executor is not compiled";
     }
@@ -414,6 +434,11 @@ void FullyConnected::setDynamicBatchLim(int lim) {
 }
 
 void FullyConnected::execute(dnnl::stream strm) {
+    if (useSparseWeights) {
+        executeSparse();
+        return;
+    }
+
     if (!execPtr) {
         IE_THROW() << "Can't execute FullyConnected node with name: " << getName() << ", because executor is not compiled";
     }
@@ -868,6 +893,136 @@ MemoryPtr FullyConnected::prepareWeightMemory(DnnlMemoryDescPtr weightDesc) {
     return ptr;
 }
 
+bool FullyConnected::useSparseWeightsDecompression() {
+    // minSparseRate == 1 means that sparse feature is switched off
+    if (minSparseRate == 1.f) {
+        return false;
+    }
+
+    sparseBlockSize = SparseFCWeights::getBlockSize();
+    if (sparseBlockSize == 0) {
+        return false;
+    }
+
+    // the sparse kernel computes f32 inner product only and doesn't support post ops
+    if (!fusedWith.empty()) {
+        return false;
+    }
+    if (getOriginalInputPrecisionAtPort(DATA_ID) != Precision::FP32 ||
+        getOriginalInputPrecisionAtPort(WEIGHTS_ID) != Precision::FP32 ||
+        getOriginalOutputPrecisionAtPort(0) != Precision::FP32 ||
+        (withBiases && getOriginalInputPrecisionAtPort(BIAS_ID) != Precision::FP32)) {
+        return false;
+    }
+    if (!one_of(getInputShapeAtPort(DATA_ID).getRank(), 2, 3) || getInputShapeAtPort(WEIGHTS_ID).getRank() != 2) {
+        return false;
+    }
+
+    auto weiNode = std::dynamic_pointer_cast<Input>(getParentEdgeAt(WEIGHTS_ID)->getParent());
+    if (!weiNode || !weiNode->isConstant()) {
+        return false;
+    }
+    auto blb = weiNode->getMemoryPtr();
+    if (!blb || blb->GetDataType() != memory::data_type::f32) {
+        return false;
+    }
+
+    // the rate of the work skipped by the kernel decides, not the rate of zeros which may be scattered over the blocks
+    const auto& weiDims = getInputShapeAtPort(WEIGHTS_ID).getStaticDims();
+    const auto sparseRate = SparseFCWeights::getSparseRate(reinterpret_cast<const float*>(blb->GetPtr()),
+                                                           weiDims[0], weiDims[1], sparseBlockSize);
+    DEBUG_LOG(getName(), ", weights packed sparse rate = ", sparseRate * 100, "%, min sparse rate = ", minSparseRate * 100, "%");
+
+    return sparseRate >= minSparseRate;
+}
+
+bool FullyConnected::canBeExecutedSparse() const {
+    // the kernel works with dense planar source and destination rows only
+    auto isDensePlanar = [](const MemoryPtr& mem) {
+        if (!mem->getDesc().hasLayoutType(LayoutType::ncsp))
+            return false;
+        const auto desc = mem->GetDescWithType<BlockedMemoryDesc>();
+        if (desc->getOffsetPadding() != 0)
+            return false;
+        const auto& dims = desc->getShape().getDims();
+        const auto& strides = desc->getStrides();
+        size_t expectedStride = 1;
+        for (int i = static_cast<int>(dims.size()) - 1; i >= 0; i--) {
+            if (dims[i] != Shape::UNDEFINED_DIM && dims[i] > 1 && strides[i] != expectedStride)
+                return false;
+            expectedStride *= dims[i];
+        }
+        return true;
+    };
+
+    return isDensePlanar(getParentEdgesAtPort(DATA_ID)[0]->getMemoryPtr()) &&
+           isDensePlanar(getChildEdgesAtPort(0)[0]->getMemoryPtr());
+}
+
+MemoryPtr FullyConnected::prepareSparseWeightMemory() {
+    auto weiMem = getParentEdgeAt(WEIGHTS_ID)->getMemoryPtr();
+    if (!weiMem)
+        IE_THROW() << "Cannot get const weights blob for node " << getName() << ".";
+    const auto& weiDims = weiMem->getStaticDims();
+    const size_t OC = weiDims[0];
+    const size_t IC = weiDims[1];
+    const auto* weights = reinterpret_cast<const float*>(weiMem->GetPtr());
+    const auto* bias = withBiases ? reinterpret_cast<const float*>(getParentEdgeAt(BIAS_ID)->getMemoryPtr()->GetPtr()) : nullptr;
+
+    auto create = [&] () {
+        const size_t packedSize = SparseFCWeights::getPackedSize(weights, OC, IC, sparseBlockSize);
+
+        MemoryPtr _ptr = std::make_shared<Memory>(getEngine());
+        _ptr->Create(std::make_shared<CpuBlockedMemoryDesc>(Precision::U8, Shape(VectorDims{packedSize})));
+        SparseFCWeights::pack(weights, bias, OC, IC, sparseBlockSize, _ptr->GetPtr());
+
+        return _ptr;
+    };
+
+    if (weightCache != nullptr) {
+        const std::string string_hash = getName() + "_sparse_" + std::to_string(sparseBlockSize)
+                                        + "_" + std::to_string(weiMem->GetSize())
+                                        + "_" + std::to_string(reinterpret_cast<uint64_t>(weiMem->GetData()));
+
+        return *weightCache->findOrCreate(string_hash, create);
+    }
+
+    return create();
+}
+
+void FullyConnected::prepareSparseParams() {
+    if (!sparseWeightsMem) {
+        sparseWeightsMem = prepareSparseWeightMemory();
+    }
+
+    if (sparseKernels.empty()) {
+        for (size_t rows = 1; rows <= jit_sparse_fc_kernel::max_rows; rows++) {
+            if (sparseBlockSize == 16) {
+                sparseKernels.emplace_back(new jit_sparse_fc_kernel_f32<dnnl::impl::cpu::x64::avx512_core>(rows));
+            } else {
+                sparseKernels.emplace_back(new jit_sparse_fc_kernel_f32<dnnl::impl::cpu::x64::avx2>(rows));
+            }
+            sparseKernels.back()->create_ker();
+        }
+    }
+}
+
+void FullyConnected::executeSparse() {
+    auto srcMemPtr = getParentEdgesAtPort(DATA_ID)[0]->getMemoryPtr();
+    auto dstMemPtr = getChildEdgesAtPort(0)[0]->getMemoryPtr();
+    const auto* src = reinterpret_cast<const float*>(srcMemPtr->GetPtr());
+    auto* dst = reinterpret_cast<float*>(dstMemPtr->GetPtr());
+
+    const auto& srcDims = srcMemPtr->getStaticDims();
+    const size_t IC = srcDims.back();
+    const size_t OC = dstMemPtr->getStaticDims().back();
+    const size_t batch = isDynamicNode() ? srcDims[0] : static_cast<size_t>(batchToProcess());
+    const size_t M = batch * std::accumulate(srcDims.begin() + 1, srcDims.end() - 1, size_t(1), std::multiplies<size_t>());
+
+    const SparseFCWeights weights(sparseWeightsMem->GetPtr(), OC, sparseBlockSize);
+    executeSparseFC(sparseKernels, weights, src, dst, M, IC, OC, sparseBlockSize);
+}
+
 }   // namespace node
 }   // namespace intel_cpu
 }   // namespace ov
@@ -10,6 +10,7 @@
 #include <string>
 #include <vector>
 #include "common/dnnl_executor.h"
+#include "kernels/sparse_fc_kernel.hpp"
 
 namespace ov {
 namespace intel_cpu {
@@ -58,6 +59,10 @@ public:
 
     void setDynamicBatchLim(int lim) override;
 
+    void setSparseWeightsDecompressionRate(float rate) {
+        minSparseRate = rate;
+    }
+
 private:
     void createDescriptorInternal(const dnnl::memory::desc &inputDesc,
                                   const dnnl::memory::desc &outputDesc);
@@ -106,6 +111,19 @@ private:
 
     bool canBeExecutedInConv1x1() const;
     MemoryPtr prepareWeightMemory(const DnnlMemoryDescPtr weightDesc);
+
+    // sparse weights
+    bool useSparseWeights = false;
+    float minSparseRate = 1.f;
+    size_t sparseBlockSize = 0;
+    MemoryPtr sparseWeightsMem;
+    std::vector<std::unique_ptr<jit_sparse_fc_kernel>> sparseKernels;
+
+    bool useSparseWeightsDecompression();
+    bool canBeExecutedSparse() const;
+    MemoryPtr prepareSparseWeightMemory();
+    void prepareSparseParams();
+    void executeSparse();
 };
 
 }   // namespace node
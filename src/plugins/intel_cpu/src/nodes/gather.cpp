@@ -170,30 +170,7 @@ void Gather::createPrimitive() {
             jitKernel->create_ker();
 
             if (!isDynamicNode()) {
-                const uint64_t dataElPerVec = jitKernel->getDataElPerVec();
-                const uint64_t nthr = parallel_get_max_threads();
-                const uint64_t wpt = ((totalWork / dataElPerVec) / nthr + 1) * dataElPerVec;
-                execParamsPerThread.resize(nthr);
-
-                parallel_nt(nthr, [&](const int ithr, const int nthr) {
-                    const uint64_t dstStart = std::min(wpt * ithr, totalWork);
-                    const uint64_t dstEnd = std::min(wpt * (ithr + 1), totalWork);
-
-                    auto& p = execParamsPerThread[ithr];
-                    p.workAmount = dstEnd - dstStart;
-                    p.dstStart = dstStart;
-                    p.specIdxInBytes.resize(dataElPerVec);
-                    p.idxBatchSumInBytes.resize(dataElPerVec);
-                    p.dataBeforeAxisSumInBytes.resize(dataElPerVec);
-                    p.betweenBatchAndAxisIter = (dstStart / specIndicesSize) % betweenBatchAndAxisSize;
-                    for (uint64_t j = 0lu; j < dataElPerVec; j++) {
-                        p.specIdxInBytes[j] = (((dstStart + j) / afterAxisSize) % specIndicesSize) * idxTypeSize;
-                        p.idxBatchSumInBytes[j] = ((dstStart + j) / (betweenBatchAndAxisSize * specIndicesSize * afterAxisSize)) *
-                                specIndicesSize * idxTypeSize;
-                        p.dataBeforeAxisSumInBytes[j] = ((dstStart + j) / (specIndicesSize * afterAxisSize)) * axisAndAfterAxisSizeInBytes;
-                    }
-                    initShortParams(p, dstStart);
-                });
+                initExecParams(parallel_get_max_threads());
             }
         }
     }
@@ -271,8 +248,14 @@ void Gather::execute(dnnl::stream strm) {
 
         const uint64_t dataElPerVec = jitKernel->getDataElPerVec();
 
-        auto threadBody = [&](const int ithr, const int nthr) {
-            auto& p = execParamsPerThread[ithr];
+        // The work is split into the parts prepared for the expected threads number, which depends on the threads limit
+        // of the node. The parts are distributed between the threads the callback is actually executed on.
+        const uint64_t partsNum = parallel_get_work_threads();
+        if (execParamsPerThread.size() != partsNum)
+            initExecParams(partsNum);
+
+        auto partBody = [&](const size_t part) {
+            auto& p = execParamsPerThread[part];
             auto arg = gatherJitExecArgs();
 
             arg.src = srcData;
@@ -310,7 +293,10 @@ void Gather::execute(dnnl::stream strm) {
             (*jitKernel)(&arg);
         };
 
-        parallel_nt(0, threadBody);
+        parallel_nt(static_cast<int>(partsNum), [&](const int ithr, const int nthr) {
+            for (size_t part = ithr; part < partsNum; part += nthr)
+                partBody(part);
+        });
     } else {
         execReference();
     }
@@ -375,6 +361,32 @@ void Gather::executeDynamicImpl(dnnl::stream strm) {
     }
 }
 
+void Gather::initExecParams(uint64_t nthr) {
+    const uint64_t dataElPerVec = jitKernel->getDataElPerVec();
+    const uint64_t wpt = ((totalWork / dataElPerVec) / nthr + 1) * dataElPerVec;
+    execParamsPerThread.resize(nthr);
+
+    parallel_for(nthr, [&](const size_t ithr) {
+        const uint64_t dstStart = std::min(wpt * ithr, totalWork);
+        const uint64_t dstEnd = std::min(wpt * (ithr + 1), totalWork);
+
+        auto& p = execParamsPerThread[ithr];
+        p.workAmount = dstEnd - dstStart;
+        p.dstStart = dstStart;
+        p.specIdxInBytes.resize(dataElPerVec);
+        p.idxBatchSumInBytes.resize(dataElPerVec);
+        p.dataBeforeAxisSumInBytes.resize(dataElPerVec);
+        p.betweenBatchAndAxisIter = (dstStart / specIndicesSize) % betweenBatchAndAxisSize;
+        for (uint64_t j = 0lu; j < dataElPerVec; j++) {
+            p.specIdxInBytes[j] = (((dstStart + j) / afterAxisSize) % specIndicesSize) * idxTypeSize;
+            p.idxBatchSumInBytes[j] = ((dstStart + j) / (betweenBatchAndAxisSize * specIndicesSize * afterAxisSize)) *
+                    specIndicesSize * idxTypeSize;
+            p.dataBeforeAxisSumInBytes[j] = ((dstStart + j) / (specIndicesSize * afterAxisSize)) * axisAndAfterAxisSizeInBytes;
+        }
+        initShortParams(p, dstStart);
+    });
+}
+
 void Gather::initShortParams(threadExecParams& p, const uint64_t start) {
     if (!jitKernel)
         THROW_ERROR << "has uninitialized kernel in function initShortParams.";
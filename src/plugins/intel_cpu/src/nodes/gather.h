@@ -51,6 +51,7 @@ protected:
     void prepareParams() override;
 
 private:
+    void initExecParams(uint64_t nthr);
     void initShortParams(threadExecParams& p, uint64_t start);
     void execReference();
 
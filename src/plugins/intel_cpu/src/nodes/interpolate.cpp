@@ -1746,6 +1746,10 @@ void Interpolate::initSupportedPrimitiveDescriptors() {
         inputPrecision = Precision::FP32;
     }
     Precision outputPrecision = inputPrecision;
+    // u8/i8 input may come from the merged Convert node, then the data is converted while loading
+    if (one_of(inputPrecision, Precision::U8, Precision::I8) && getOriginalOutputPrecisionAtPort(DATA_ID) == Precision::FP32) {
+        outputPrecision = Precision::FP32;
+    }
 
     if (!fusedWith.empty()) {
         outputPrecision = fusedWith[fusedWith.size() - 1]->getOriginalOutputPrecisionAtPort(DATA_ID);
@@ -3260,6 +3264,12 @@ bool Interpolate::canFuse(const NodePtr& node) const {
     return canFuseSimpleOperation(node);
 }
 
+bool Interpolate::canConvertInputWhileLoading() const {
+    const auto dataRank = getInputShapeAtPort(DATA_ID).getRank();
+    return mayiuse(cpu::x64::sse41) && interpAttrs.mode != InterpolateMode::linear &&
+           (dataRank == 4 || (dataRank == 5 && interpAttrs.mode != InterpolateMode::cubic));
+}
+
 bool Interpolate::created() const {
     return getType() == Type::Interpolate;
 }
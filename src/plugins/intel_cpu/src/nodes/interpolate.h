@@ -114,6 +114,9 @@ public:
         return false;
     }
     bool canFuse(const NodePtr& node) const override;
+    // The JIT kernels for the channel-last and blocked layouts load u8/i8 data as f32 and support fusing, the other
+    // implementations need the f32 input
+    bool canConvertInputWhileLoading() const;
 
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
 
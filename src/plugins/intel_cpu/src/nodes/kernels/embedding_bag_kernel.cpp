@@ -0,0 +1,105 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "embedding_bag_kernel.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::utils;
+using namespace dnnl::impl::cpu::x64;
+
+#define GET_OFF(field) offsetof(jit_emb_bag_call_args, field)
+
+namespace ov {
+namespace intel_cpu {
+
+template <cpu_isa_t isa>
+jit_emb_bag_kernel_f32<isa>::jit_emb_bag_kernel_f32(InferenceEngine::Precision src_prc, size_t vecs)
+    : jit_emb_bag_kernel(src_prc, vecs),
+      jit_generator(jit_name()) {
+    assert(vecs > 0 && vecs <= max_vecs);
+    assert(one_of(src_prc, InferenceEngine::Precision::FP32, InferenceEngine::Precision::BF16));
+}
+
+template <cpu_isa_t isa>
+void jit_emb_bag_kernel_f32<isa>::create_ker() {
+    jit_generator::create_kernel();
+    ker_ = (decltype(ker_))jit_ker();
+}
+
+template <cpu_isa_t isa>
+void jit_emb_bag_kernel_f32<isa>::load_src(const Vmm& vmm, const Xbyak::Address& addr) {
+    if (src_prc_ == InferenceEngine::Precision::BF16) {
+        vpmovzxwd(vmm, addr);
+        vpslld(vmm, vmm, 16);
+    } else {
+        uni_vmovups(vmm, addr);
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_emb_bag_kernel_f32<isa>::generate() {
+    const size_t src_vec_size = vlen / sizeof(float) * src_prc_.size();
+    const size_t cache_line = 64;
+    const size_t prefetch_lines = div_up(vecs_ * src_vec_size, cache_line);
+
+    this->preamble();
+
+    mov(reg_table, ptr[reg_params + GET_OFF(table)]);
+    mov(reg_indices, ptr[reg_params + GET_OFF(indices)]);
+    mov(reg_weights, ptr[reg_params + GET_OFF(weights)]);
+    mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+    mov(reg_row_stride, ptr[reg_params + GET_OFF(row_stride)]);
+    mov(reg_weights_stride, ptr[reg_params + GET_OFF(weights_stride)]);
+    mov(reg_num, ptr[reg_params + GET_OFF(num_indices)]);
+
+    for (size_t v = 0; v < vecs_; v++)
+        uni_vpxor(get_acc_reg(v), get_acc_reg(v), get_acc_reg(v));
+
+    Xbyak::Label main_loop_label;
+    Xbyak::Label main_loop_end_label;
+    Xbyak::Label prefetch_end_label;
+
+    L(main_loop_label);
+    {
+        cmp(reg_num, 0);
+        je(main_loop_end_label, T_NEAR);
+
+        // the rows are spread over the table, so the hardware prefetcher can not predict them
+        cmp(reg_num, prefetch_dist);
+        jbe(prefetch_end_label, T_NEAR);
+        movsxd(reg_prefetch, dword[reg_indices + prefetch_dist * sizeof(int32_t)]);
+        imul(reg_prefetch, reg_row_stride);
+        add(reg_prefetch, reg_table);
+        for (size_t l = 0; l < prefetch_lines; l++)
+            prefetcht0(ptr[reg_prefetch + l * cache_line]);
+        L(prefetch_end_label);
+
+        movsxd(reg_row, dword[reg_indices]);
+        imul(reg_row, reg_row_stride);
+        add(reg_row, reg_table);
+
+        uni_vbroadcastss(vmm_weight, ptr[reg_weights]);
+        for (size_t v = 0; v < vecs_; v++) {
+            load_src(vmm_src, ptr[reg_row + v * src_vec_size]);
+            uni_vfmadd231ps(get_acc_reg(v), vmm_src, vmm_weight);
+        }
+
+        add(reg_indices, sizeof(int32_t));
+        add(reg_weights, reg_weights_stride);
+        dec(reg_num);
+        jmp(main_loop_label, T_NEAR);
+    }
+    L(main_loop_end_label);
+
+    for (size_t v = 0; v < vecs_; v++)
+        uni_vmovups(ptr[reg_dst + v * vlen], get_acc_reg(v));
+
+    this->postamble();
+}
+
+template struct jit_emb_bag_kernel_f32<avx2>;
+template struct jit_emb_bag_kernel_f32<avx512_core>;
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,92 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_precision.hpp>
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include <cpu/x64/jit_generator.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+struct jit_emb_bag_call_args {
+    // embedding table shifted to the first processed column
+    const void* table;
+    const int32_t* indices;
+    const float* weights;
+    float* dst;
+
+    // table row size in bytes
+    size_t row_stride;
+    // 0 for bags without per sample weights, so the same weight is applied to all the rows
+    size_t weights_stride;
+    size_t num_indices;
+};
+
+/**
+ * Accumulates the weighted sum of the embedding table rows of one bag for a columns block
+ * of `vecs` vector registers width. The table may be stored in f32 or bf16, the sum is always f32.
+ */
+struct jit_emb_bag_kernel {
+    static constexpr size_t max_vecs = 8;
+
+    void (*ker_)(const jit_emb_bag_call_args*);
+
+    void operator()(const jit_emb_bag_call_args* args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    jit_emb_bag_kernel(InferenceEngine::Precision src_prc, size_t vecs) : ker_(nullptr), src_prc_(src_prc), vecs_(vecs) {}
+    virtual ~jit_emb_bag_kernel() {}
+
+    virtual void create_ker() = 0;
+
+protected:
+    InferenceEngine::Precision src_prc_;
+    // number of vector registers of the accumulated columns block
+    size_t vecs_;
+};
+
+template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+struct jit_emb_bag_kernel_f32 : public jit_emb_bag_kernel, public dnnl::impl::cpu::x64::jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_emb_bag_kernel_f32)
+
+    jit_emb_bag_kernel_f32(InferenceEngine::Precision src_prc, size_t vecs);
+
+    void create_ker() override;
+    void generate() override;
+
+private:
+    using Vmm = typename dnnl::impl::utils::conditional<isa == dnnl::impl::cpu::x64::avx2,
+                                                        Xbyak::Ymm,
+                                                        Xbyak::Zmm>::type;
+    const size_t vlen = dnnl::impl::cpu::x64::cpu_isa_traits<isa>::vlen;
+    // the distance (in bag indices) of software prefetch of the table rows
+    const size_t prefetch_dist = 4;
+
+    void load_src(const Vmm& vmm, const Xbyak::Address& addr);
+
+    Xbyak::Reg64 reg_table = r8;
+    Xbyak::Reg64 reg_indices = r9;
+    Xbyak::Reg64 reg_weights = r10;
+    Xbyak::Reg64 reg_dst = r11;
+    Xbyak::Reg64 reg_row_stride = r12;
+    Xbyak::Reg64 reg_weights_stride = r13;
+    Xbyak::Reg64 reg_num = r14;
+    Xbyak::Reg64 reg_row = r15;
+    Xbyak::Reg64 reg_prefetch = rax;
+    Xbyak::Reg64 reg_params = Xbyak::Reg64(dnnl::impl::cpu::x64::abi_param_regs[0]);
+
+    Vmm vmm_src = Vmm(max_vecs);
+    Vmm vmm_weight = Vmm(max_vecs + 1);
+
+    Vmm get_acc_reg(size_t vec) {
+        return Vmm(vec);
+    }
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,235 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "sparse_fc_kernel.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include <ie_parallel.hpp>
+#include "common/cpu_memcpy.h"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::utils;
+using namespace dnnl::impl::cpu::x64;
+
+#define GET_OFF(field) offsetof(jit_sparse_fc_call_args, field)
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+constexpr size_t packedValuesAlignment = 64;
+
+size_t getValuesOffset(size_t ocBlocks, size_t nnzCols) {
+    return rnd_up((ocBlocks + 1 + nnzCols) * sizeof(int32_t), packedValuesAlignment);
+}
+
+bool isColumnZero(const float* weights, size_t IC, size_t ocStart, size_t ocEnd, size_t ic) {
+    for (size_t oc = ocStart; oc < ocEnd; oc++) {
+        if (weights[oc * IC + ic] != 0.f)
+            return false;
+    }
+    return true;
+}
+
+size_t countStoredColumns(const float* weights, size_t OC, size_t IC, size_t blk) {
+    const size_t ocBlocks = div_up(OC, blk);
+    size_t nnzCols = 0;
+    for (size_t ob = 0; ob < ocBlocks; ob++) {
+        const size_t ocEnd = std::min(OC, (ob + 1) * blk);
+        for (size_t ic = 0; ic < IC; ic++) {
+            if (!isColumnZero(weights, IC, ob * blk, ocEnd, ic))
+                nnzCols++;
+        }
+    }
+    return nnzCols;
+}
+
+}   // namespace
+
+SparseFCWeights::SparseFCWeights(const void* packed, size_t OC, size_t blk) {
+    const size_t ocBlocks = div_up(OC, blk);
+    const auto* ptr = reinterpret_cast<const uint8_t*>(packed);
+
+    blkOffsets = reinterpret_cast<const int32_t*>(ptr);
+    icOffsets = blkOffsets + ocBlocks + 1;
+
+    const size_t nnzCols = static_cast<size_t>(blkOffsets[ocBlocks]);
+    values = reinterpret_cast<const float*>(ptr + getValuesOffset(ocBlocks, nnzCols));
+    bias = values + nnzCols * blk;
+}
+
+size_t SparseFCWeights::getBlockSize() {
+    if (mayiuse(avx512_core))
+        return cpu_isa_traits<avx512_core>::vlen / sizeof(float);
+    if (mayiuse(avx2))
+        return cpu_isa_traits<avx2>::vlen / sizeof(float);
+    return 0;
+}
+
+float SparseFCWeights::getSparseRate(const float* weights, size_t OC, size_t IC, size_t blk) {
+    const size_t allCols = div_up(OC, blk) * IC;
+    if (allCols == 0)
+        return 0.f;
+    const size_t nnzCols = countStoredColumns(weights, OC, IC, blk);
+    return static_cast<float>(allCols - nnzCols) / static_cast<float>(allCols);
+}
+
+size_t SparseFCWeights::getPackedSize(const float* weights, size_t OC, size_t IC, size_t blk) {
+    const size_t ocBlocks = div_up(OC, blk);
+    const size_t nnzCols = countStoredColumns(weights, OC, IC, blk);
+
+    return getValuesOffset(ocBlocks, nnzCols) + (nnzCols + ocBlocks) * blk * sizeof(float);
+}
+
+void SparseFCWeights::pack(const float* weights, const float* bias, size_t OC, size_t IC, size_t blk, void* packed) {
+    const size_t ocBlocks = div_up(OC, blk);
+    auto* blkOffsets = reinterpret_cast<int32_t*>(packed);
+    auto* icOffsets = blkOffsets + ocBlocks + 1;
+
+    size_t nnzCols = 0;
+    for (size_t ob = 0; ob < ocBlocks; ob++) {
+        blkOffsets[ob] = static_cast<int32_t>(nnzCols);
+        const size_t ocEnd = std::min(OC, (ob + 1) * blk);
+        for (size_t ic = 0; ic < IC; ic++) {
+            if (!isColumnZero(weights, IC, ob * blk, ocEnd, ic))
+                icOffsets[nnzCols++] = static_cast<int32_t>(ic * sizeof(float));
+        }
+    }
+    blkOffsets[ocBlocks] = static_cast<int32_t>(nnzCols);
+
+    auto* values = reinterpret_cast<float*>(reinterpret_cast<uint8_t*>(packed) + getValuesOffset(ocBlocks, nnzCols));
+    for (size_t ob = 0; ob < ocBlocks; ob++) {
+        const size_t ocStart = ob * blk;
+        for (int32_t col = blkOffsets[ob]; col < blkOffsets[ob + 1]; col++) {
+            const size_t ic = icOffsets[col] / sizeof(float);
+            float* dst = values + col * blk;
+            for (size_t i = 0; i < blk; i++) {
+                const size_t oc = ocStart + i;
+                dst[i] = oc < OC ? weights[oc * IC + ic] : 0.f;
+            }
+        }
+    }
+
+    auto* packedBias = values + nnzCols * blk;
+    std::memset(packedBias, 0, ocBlocks * blk * sizeof(float));
+    if (bias)
+        std::memcpy(packedBias, bias, OC * sizeof(float));
+}
+
+template <cpu_isa_t isa>
+jit_sparse_fc_kernel_f32<isa>::jit_sparse_fc_kernel_f32(size_t rows)
+    : jit_sparse_fc_kernel(rows),
+      jit_generator(jit_name()) {
+    assert(rows > 0 && rows <= max_rows);
+}
+
+template <cpu_isa_t isa>
+void jit_sparse_fc_kernel_f32<isa>::create_ker() {
+    jit_generator::create_kernel();
+    ker_ = (decltype(ker_))jit_ker();
+}
+
+template <cpu_isa_t isa>
+void jit_sparse_fc_kernel_f32<isa>::generate() {
+    this->preamble();
+
+    mov(reg_src[0], ptr[reg_params + GET_OFF(src)]);
+    mov(reg_values, ptr[reg_params + GET_OFF(values)]);
+    mov(reg_ic_offsets, ptr[reg_params + GET_OFF(ic_offsets)]);
+    mov(reg_bias, ptr[reg_params + GET_OFF(bias)]);
+    mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+    mov(reg_nnz, ptr[reg_params + GET_OFF(nnz)]);
+
+    mov(reg_stride, ptr[reg_params + GET_OFF(src_stride)]);
+    for (size_t r = 1; r < rows_; r++) {
+        mov(reg_src[r], reg_src[r - 1]);
+        add(reg_src[r], reg_stride);
+    }
+
+    for (size_t r = 0; r < rows_; r++)
+        uni_vmovups(get_acc_reg(r), ptr[reg_bias]);
+
+    Xbyak::Label main_loop_label;
+    Xbyak::Label main_loop_end_label;
+
+    L(main_loop_label);
+    {
+        cmp(reg_nnz, 0);
+        je(main_loop_end_label, T_NEAR);
+
+        prefetcht0(ptr[reg_values + prefetch_dist * vlen]);
+
+        movsxd(reg_offset, dword[reg_ic_offsets]);
+        uni_vmovups(vmm_wei, ptr[reg_values]);
+        for (size_t r = 0; r < rows_; r++) {
+            uni_vbroadcastss(vmm_src, ptr[reg_src[r] + reg_offset]);
+            uni_vfmadd231ps(get_acc_reg(r), vmm_wei, vmm_src);
+        }
+
+        add(reg_values, vlen);
+        add(reg_ic_offsets, sizeof(int32_t));
+        dec(reg_nnz);
+        jmp(main_loop_label, T_NEAR);
+    }
+    L(main_loop_end_label);
+
+    mov(reg_stride, ptr[reg_params + GET_OFF(dst_stride)]);
+    for (size_t r = 0; r < rows_; r++) {
+        uni_vmovups(ptr[reg_dst], get_acc_reg(r));
+        if (r + 1 < rows_)
+            add(reg_dst, reg_stride);
+    }
+
+    this->postamble();
+}
+
+template struct jit_sparse_fc_kernel_f32<avx2>;
+template struct jit_sparse_fc_kernel_f32<avx512_core>;
+
+void executeSparseFC(const std::vector<std::unique_ptr<jit_sparse_fc_kernel>>& kernels,
+                     const SparseFCWeights& weights,
+                     const float* src,
+                     float* dst,
+                     size_t M,
+                     size_t IC,
+                     size_t OC,
+                     size_t blk) {
+    const size_t maxRows = kernels.size();
+    const size_t ocBlocks = div_up(OC, blk);
+    const size_t mBlocks = div_up(M, maxRows);
+
+    InferenceEngine::parallel_for2d(mBlocks, ocBlocks, [&](size_t mb, size_t ob) {
+        const size_t mStart = mb * maxRows;
+        const size_t rows = std::min(maxRows, M - mStart);
+        const size_t ocStart = ob * blk;
+        const size_t ocWork = std::min(blk, OC - ocStart);
+
+        // the tail of output channels is computed into the local buffer to avoid out of bounds writes
+        float dstTail[jit_sparse_fc_kernel::max_rows * 16];
+        const bool isTail = ocWork != blk;
+
+        jit_sparse_fc_call_args args;
+        args.src = src + mStart * IC;
+        args.values = weights.values + weights.blkOffsets[ob] * blk;
+        args.ic_offsets = weights.icOffsets + weights.blkOffsets[ob];
+        args.bias = weights.bias + ocStart;
+        args.dst = isTail ? dstTail : dst + mStart * OC + ocStart;
+        args.src_stride = IC * sizeof(float);
+        args.dst_stride = (isTail ? blk : OC) * sizeof(float);
+        args.nnz = weights.blkOffsets[ob + 1] - weights.blkOffsets[ob];
+
+        (*kernels[rows - 1])(&args);
+
+        if (isTail) {
+            for (size_t r = 0; r < rows; r++)
+                cpu_memcpy(dst + (mStart + r) * OC + ocStart, dstTail + r * blk, ocWork * sizeof(float));
+        }
+    });
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,126 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include <cpu/x64/jit_generator.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Block-compressed sparse weights of FullyConnected layer.
+ *
+ * Output channels are split into blocks of the vector register width. For every block only the input channels
+ * having at least one non-zero weight in the block are stored, so the packed buffer has the following layout:
+ *   int32_t blk_offsets[oc_blocks + 1]      - index of the first stored column of each output channels block
+ *   int32_t ic_offsets[nnz_cols]            - byte offset of the input channel of each stored column in a source row
+ *   float   values[nnz_cols * blk]          - weights of the stored columns (64 bytes aligned)
+ *   float   bias[oc_blocks * blk]           - bias zero padded up to the block size
+ */
+struct SparseFCWeights {
+    SparseFCWeights(const void* packed, size_t OC, size_t blk);
+
+    // Returns the output channels block size for the current ISA or 0 if the sparse kernel is not supported
+    static size_t getBlockSize();
+    // Returns the rate of the columns skipped by the packed format, i.e. the input channels which are zero in a whole
+    // output channels block. Zeros scattered over the blocks are still stored, so it may be lower than the rate of zeros.
+    static float getSparseRate(const float* weights, size_t OC, size_t IC, size_t blk);
+
+    static size_t getPackedSize(const float* weights, size_t OC, size_t IC, size_t blk);
+    static void pack(const float* weights, const float* bias, size_t OC, size_t IC, size_t blk, void* packed);
+
+    const int32_t* blkOffsets = nullptr;
+    const int32_t* icOffsets = nullptr;
+    const float* values = nullptr;
+    const float* bias = nullptr;
+};
+
+struct jit_sparse_fc_call_args {
+    const float* src;
+    const float* values;
+    const int32_t* ic_offsets;
+    const float* bias;
+    float* dst;
+
+    size_t src_stride;
+    size_t dst_stride;
+    size_t nnz;
+};
+
+struct jit_sparse_fc_kernel {
+    static constexpr size_t max_rows = 4;
+
+    void (*ker_)(const jit_sparse_fc_call_args*);
+
+    void operator()(const jit_sparse_fc_call_args* args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_sparse_fc_kernel(size_t rows) : ker_(nullptr), rows_(rows) {}
+    virtual ~jit_sparse_fc_kernel() {}
+
+    virtual void create_ker() = 0;
+
+protected:
+    // number of source rows processed by one kernel call
+    size_t rows_;
+};
+
+template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+struct jit_sparse_fc_kernel_f32 : public jit_sparse_fc_kernel, public dnnl::impl::cpu::x64::jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_sparse_fc_kernel_f32)
+
+    explicit jit_sparse_fc_kernel_f32(size_t rows);
+
+    void create_ker() override;
+    void generate() override;
+
+private:
+    using Vmm = typename dnnl::impl::utils::conditional<isa == dnnl::impl::cpu::x64::avx2,
+                                                        Xbyak::Ymm,
+                                                        Xbyak::Zmm>::type;
+    const size_t vlen = dnnl::impl::cpu::x64::cpu_isa_traits<isa>::vlen;
+    // the distance (in stored columns) of software prefetch of the weights values
+    const size_t prefetch_dist = 8;
+
+    Xbyak::Reg64 reg_src[max_rows] = {r8, r9, r10, r11};
+    Xbyak::Reg64 reg_values = r12;
+    Xbyak::Reg64 reg_ic_offsets = r13;
+    Xbyak::Reg64 reg_nnz = r14;
+    Xbyak::Reg64 reg_dst = r15;
+    Xbyak::Reg64 reg_stride = rax;
+    Xbyak::Reg64 reg_offset = rbx;
+    Xbyak::Reg64 reg_bias = rdx;
+    Xbyak::Reg64 reg_params = Xbyak::Reg64(dnnl::impl::cpu::x64::abi_param_regs[0]);
+
+    Vmm vmm_wei = Vmm(max_rows);
+    Vmm vmm_src = Vmm(max_rows + 1);
+
+    Vmm get_acc_reg(size_t row) {
+        return Vmm(row);
+    }
+};
+
+/**
+ * Computes dst[M, OC] = src[M, IC] * weights[OC, IC]^T + bias using the kernels processing 1..kernels.size() source
+ * rows per call (the kernel at index i processes i + 1 rows). The tail of output channels which is not a multiple
+ * of the block size is computed into a local buffer, so nothing is written past the end of dst rows.
+ */
+void executeSparseFC(const std::vector<std::unique_ptr<jit_sparse_fc_kernel>>& kernels,
+                     const SparseFCWeights& weights,
+                     const float* src,
+                     float* dst,
+                     size_t M,
+                     size_t IC,
+                     size_t OC,
+                     size_t blk);
+
+}   // namespace intel_cpu
+}   // namespace ov
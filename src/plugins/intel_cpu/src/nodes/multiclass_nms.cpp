@@ -16,6 +16,7 @@
 #include <vector>
 
 #include "ie_parallel.hpp"
+#include "non_max_suppression.h"
 #include "utils/general_utils.h"
 #include <utils/shape_inference/shape_inference_internal_dyn.hpp>
 
@@ -133,6 +134,19 @@ void MultiClassNms::initSupportedPrimitiveDescriptors() {
     }
 }
 
+void MultiClassNms::createPrimitive() {
+    // the kernel doesn't add 1 to the sizes of not normalized boxes, and it can't suppress the candidate by zero iou
+    if (!m_nmsKernel && m_normalized && m_iouThreshold > 0.f) {
+        auto jcp = jit_nms_config_params();
+        jcp.box_encode_type = NMSBoxEncodeType::CORNER;
+        jcp.is_soft_suppressed_by_iou = false;
+        jcp.is_iou_threshold_strict = false;
+        m_nmsKernel = createNmsKernel(jcp);
+    }
+
+    Node::createPrimitive();
+}
+
 // shared           Y               N
 // boxes:       N, M, 4         C, sum(M'), 4
 // scores:      N, C, M         C, sum(M')
@@ -555,28 +569,72 @@ void MultiClassNms::nmsWithoutEta(const float* boxes,
 
             int io_selection_size = 0;
             if (sorted_boxes.size() > 0) {
-                parallel_sort(sorted_boxes.begin(), sorted_boxes.end(), [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
+                // only nms_top_k candidates with the highest scores take part in the selection
+                const size_t max_out_box = std::min(sorted_boxes.size(), static_cast<size_t>(m_nmsRealTopk));
+                std::partial_sort(sorted_boxes.begin(), sorted_boxes.begin() + max_out_box, sorted_boxes.end(),
+                    [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
                     return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
                 });
                 int offset = batch_idx * m_numClasses * m_nmsRealTopk + class_idx * m_nmsRealTopk;
                 m_filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
                 io_selection_size++;
-                int max_out_box = (m_nmsRealTopk > sorted_boxes.size()) ? sorted_boxes.size() : m_nmsRealTopk;
-                for (size_t box_idx = 1; box_idx < max_out_box; box_idx++) {
-                    bool box_is_selected = true;
-                    for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                        float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[box_idx].second * 4],
-                            &boxesPtr[m_filtBoxes[offset + idx].box_index * 4], m_normalized);
-                        if (iou >= m_iouThreshold) {
-                            box_is_selected = false;
-                            break;
+
+                // the kernel normalizes the corners of the boxes, so it is applied only if they are already ordered
+                bool isKernelApplicable = m_nmsKernel && max_out_box > 1;
+                for (size_t box_idx = 0; box_idx < max_out_box && isKernelApplicable; box_idx++) {
+                    const float* box = &boxesPtr[sorted_boxes[box_idx].second * 4];
+                    isKernelApplicable = box[0] < box[2] && box[1] < box[3];
+                }
+
+                if (isKernelApplicable) {
+                    // selected boxes are stored per coordinate, so iou with a vector of them is computed at once
+                    std::vector<float> selectedCoords(4 * max_out_box);
+                    for (int k = 0; k < 4; k++)
+                        selectedCoords[k * max_out_box] = boxesPtr[sorted_boxes[0].second * 4 + k];
+                    const float noScale = 0.f;
+                    float score = 0.f;
+
+                    auto arg = jit_nms_args();
+                    arg.iou_threshold = &m_iouThreshold;
+                    arg.score_threshold = &noScale;
+                    arg.scale = &noScale;
+                    arg.score = &score;
+                    for (int k = 0; k < 4; k++)
+                        arg.selected_boxes_coord[k] = selectedCoords.data() + k * max_out_box;
+
+                    for (size_t box_idx = 1; box_idx < max_out_box; box_idx++) {
+                        const float* box = &boxesPtr[sorted_boxes[box_idx].second * 4];
+                        int status = NMSCandidateStatus::SELECTED;
+                        arg.selected_boxes_num = io_selection_size;
+                        arg.candidate_box = box;
+                        arg.candidate_status = &status;
+                        (*m_nmsKernel)(&arg);
+
+                        if (status == NMSCandidateStatus::SELECTED) {
+                            for (int k = 0; k < 4; k++)
+                                selectedCoords[k * max_out_box + io_selection_size] = box[k];
+                            m_filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first, batch_idx, class_idx,
+                                sorted_boxes[box_idx].second);
+                            io_selection_size++;
                         }
                     }
+                } else {
+                    for (size_t box_idx = 1; box_idx < max_out_box; box_idx++) {
+                        bool box_is_selected = true;
+                        for (int idx = io_selection_size - 1; idx >= 0; idx--) {
+                            float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[box_idx].second * 4],
+                                &boxesPtr[m_filtBoxes[offset + idx].box_index * 4], m_normalized);
+                            if (iou >= m_iouThreshold) {
+                                box_is_selected = false;
+                                break;
+                            }
+                        }
 
-                    if (box_is_selected) {
-                        m_filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first, batch_idx, class_idx,
-                            sorted_boxes[box_idx].second);
-                        io_selection_size++;
+                        if (box_is_selected) {
+                            m_filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first, batch_idx, class_idx,
+                                sorted_boxes[box_idx].second);
+                            io_selection_size++;
+                        }
                     }
                 }
             }
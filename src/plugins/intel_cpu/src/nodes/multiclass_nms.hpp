@@ -13,6 +13,8 @@ namespace ov {
 namespace intel_cpu {
 namespace node {
 
+struct jit_uni_nms_kernel;
+
 enum class MulticlassNmsSortResultType {
     CLASSID,  // sort selected boxes by class id (ascending) in each batch element
     SCORE,    // sort selected boxes by score (descending) in each batch element
@@ -25,6 +27,7 @@ public:
 
     void getSupportedDescriptors() override {};
     void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
     void execute(dnnl::stream strm) override;
     bool created() const override;
 
@@ -89,6 +92,9 @@ private:
 
     std::vector<filteredBoxes> m_filtBoxes; // rois after nms for each class in each image
 
+    // computes iou of the candidate with a vector of the selected boxes in NMS without eta
+    std::shared_ptr<jit_uni_nms_kernel> m_nmsKernel;
+
     void checkPrecision(const InferenceEngine::Precision prec, const std::vector<InferenceEngine::Precision> precList, const std::string name,
                         const std::string type);
 
@@ -376,15 +376,20 @@ private:
         L(terminate_label);
     }
 
+    // _CMP_GT_OS or _CMP_GE_OS
+    inline uint8_t iou_cmp_predicate() const {
+        return jcp.is_iou_threshold_strict ? 0x0E : 0x0D;
+    }
+
     inline void suppressed_by_iou(bool is_scalar) {
         if (mayiuse(cpu::x64::avx512_core)) {
-            vcmpps(k_mask, vmm_temp3, vmm_iou_threshold, 0x0D); // _CMP_GE_OS. vcmpps w/ kmask only on V5
+            vcmpps(k_mask, vmm_temp3, vmm_iou_threshold, iou_cmp_predicate()); // vcmpps w/ kmask only on V5
             if (is_scalar)
                 kandw(k_mask, k_mask, k_mask_one);
             kortestw(k_mask, k_mask);    // bitwise check if all zero
         } else if (mayiuse(cpu::x64::avx)) {
             // vex instructions with xmm on avx and ymm on avx2
-            vcmpps(vmm_temp4, vmm_temp3, vmm_iou_threshold, 0x0D);  // xmm and ymm only on V1.
+            vcmpps(vmm_temp4, vmm_temp3, vmm_iou_threshold, iou_cmp_predicate());  // xmm and ymm only on V1.
             if (is_scalar) {
                 uni_vpextrd(reg_temp_32, Xmm(vmm_temp4.getIdx()), 0);
                 test(reg_temp_32, reg_temp_32);
@@ -397,7 +402,8 @@ private:
             cmpps(vmm_temp4, vmm_iou_threshold, 0x07);  // order compare, 0 for at least one is NaN
 
             uni_vmovups(vmm_temp2, vmm_temp3);
-            cmpps(vmm_temp2, vmm_iou_threshold, 0x05);   // _CMP_GE_US on sse, no direct _CMP_GE_OS supported.
+            // _CMP_GE_US/_CMP_GT_US on sse, no direct _CMP_GE_OS/_CMP_GT_OS supported.
+            cmpps(vmm_temp2, vmm_iou_threshold, jcp.is_iou_threshold_strict ? 0x06 : 0x05);
 
             uni_vandps(vmm_temp4, vmm_temp4, vmm_temp2);
             if (is_scalar) {
@@ -552,6 +558,21 @@ private:
     }
 };
 
+std::shared_ptr<jit_uni_nms_kernel> createNmsKernel(const jit_nms_config_params& jcp) {
+    std::shared_ptr<jit_uni_nms_kernel> kernel;
+    if (mayiuse(cpu::x64::avx512_core)) {
+        kernel.reset(new jit_uni_nms_kernel_f32<cpu::x64::avx512_core>(jcp));
+    } else if (mayiuse(cpu::x64::avx2)) {
+        kernel.reset(new jit_uni_nms_kernel_f32<cpu::x64::avx2>(jcp));
+    } else if (mayiuse(cpu::x64::sse41)) {
+        kernel.reset(new jit_uni_nms_kernel_f32<cpu::x64::sse41>(jcp));
+    }
+
+    if (kernel)
+        kernel->create_ker();
+    return kernel;
+}
+
 bool NonMaxSuppression::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
         // TODO [DS NMS]: remove when nodes from models where nms is not last node in model supports DS
@@ -704,16 +725,7 @@ void NonMaxSuppression::createJitKernel() {
     jcp.box_encode_type = boxEncodingType;
     jcp.is_soft_suppressed_by_iou = isSoftSuppressedByIOU;
 
-    if (mayiuse(cpu::x64::avx512_core)) {
-        nms_kernel.reset(new jit_uni_nms_kernel_f32<cpu::x64::avx512_core>(jcp));
-    } else if (mayiuse(cpu::x64::avx2)) {
-        nms_kernel.reset(new jit_uni_nms_kernel_f32<cpu::x64::avx2>(jcp));
-    } else if (mayiuse(cpu::x64::sse41)) {
-        nms_kernel.reset(new jit_uni_nms_kernel_f32<cpu::x64::sse41>(jcp));
-    }
-
-    if (nms_kernel)
-        nms_kernel->create_ker();
+    nms_kernel = createNmsKernel(jcp);
 }
 
 void NonMaxSuppression::executeDynamicImpl(dnnl::stream strm) {
@@ -32,6 +32,8 @@ enum NMSCandidateStatus {
 struct jit_nms_config_params {
     NMSBoxEncodeType box_encode_type;
     bool is_soft_suppressed_by_iou;
+    // suppress the candidate if iou > iou_threshold instead of iou >= iou_threshold
+    bool is_iou_threshold_strict;
 };
 
 struct jit_nms_args {
@@ -62,6 +64,10 @@ struct jit_uni_nms_kernel {
     jit_nms_config_params jcp;
 };
 
+// Returns the kernel for the best ISA supported by the machine or nullptr if there is no such ISA.
+// The kernel is shape agnostic, so it is shared by the nodes doing NMS of the boxes in the corner format.
+std::shared_ptr<jit_uni_nms_kernel> createNmsKernel(const jit_nms_config_params& jcp);
+
 class NonMaxSuppression : public Node {
 public:
     NonMaxSuppression(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& eng, WeightsSharing::Ptr &cache);
@@ -6,6 +6,7 @@
 #include "common/cpu_memcpy.h"
 #include "common/blocked_desc_creator.h"
 #include <vector>
+#include <algorithm>
 #include <dnnl_types.h>
 #include <dnnl_extension_utils.h>
 #include <ie_parallel.hpp>
@@ -169,8 +170,29 @@ void Split::initSupportedPrimitiveDescriptors() {
     }
 
     // Optimized inplace case
-    // TODO [DS]: inplace
-    if (!isDynamicNode()) {
+    if (isDynamicNode()) {
+        // The outputs are dense parts of the input, whose offsets are resolved at runtime by the memory partitions.
+        // So in place is possible only for the plain layout when all the dims before axis are 1 and the split lengths are static.
+        const auto& inDims = srcShape.getDims();
+        bool canBeInPlace = std::all_of(inDims.begin(), inDims.begin() + axis, [](Dim dim) { return dim == 1; }) &&
+                            inDims[axis] != Shape::UNDEFINED_DIM;
+        for (size_t i = 0; i < outputShapes.size() && canBeInPlace; i++) {
+            const auto partDim = outputShapes[i].getDims()[axis];
+            canBeInPlace = partDim != Shape::UNDEFINED_DIM && partDim != 0;
+        }
+
+        for (auto refPdIndex : pdIndexesToReuse) {
+            const auto& refConfig = supportedPrimitiveDescriptors[refPdIndex].getConfig();
+            if (!canBeInPlace || !refConfig.inConfs[0].getMemDesc()->hasLayoutType(LayoutType::ncsp))
+                continue;
+
+            auto config = refConfig;
+            for (size_t i = 0; i < outputShapes.size(); i++) {
+                config.outConfs[i].inPlace(0);
+            }
+            supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown);
+        }
+    } else {
         for (auto refPdIndex : pdIndexesToReuse) {
             const auto& refConfig = supportedPrimitiveDescriptors[refPdIndex].getConfig();
             auto config = refConfig;
@@ -376,6 +398,31 @@ void Split::initOptimalPrimitiveDescriptor() {
     }
 }
 
+void Split::resolveInPlaceEdges() {
+    if (!isDynamicNode() || !isOptimized()) {
+        Node::resolveInPlaceEdges();
+        return;
+    }
+
+    const auto& config = getSelectedPrimitiveDescriptor()->getConfig();
+    auto baseMemMngr = getParentEdgesAtPort(0)[0]->getMemory().getDnnlMemoryMngr();
+    const size_t totalChunks = getInputShapeAtPort(0).getDims()[axis];
+    size_t offsetChunk = 0;
+    for (size_t port = 0; port < outputShapes.size(); port++) {
+        const size_t sizeChunk = outputShapes[port].getDims()[axis];
+        auto memMngr = baseMemMngr->createPartition(totalChunks, offsetChunk, sizeChunk);
+        for (auto& childEdge : getChildEdgesAtPort(port)) {
+            if (childEdge->getStatus() != Edge::Status::NotAllocated)
+                THROW_ERROR << "has unexpectedly allocated output memory at port " << port;
+
+            childEdge->getMemoryPtr().reset(new Memory(getEngine()));
+            childEdge->getMemoryPtr()->Create(config.outConfs[port].getMemDesc(), memMngr);
+            childEdge->changeStatus(Edge::Status::Allocated);
+        }
+        offsetChunk += sizeChunk;
+    }
+}
+
 void Split::selectOptimalPrimitiveDescriptor() {
     // Enforce the reference implementation for the planar layout if the implementation is in the impl priorities list.
     // This is needed mostly for the testing purposes, since for the planar layout Split works always in place, we need to enforce
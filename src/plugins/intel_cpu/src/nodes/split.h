@@ -25,6 +25,7 @@ public:
 
     bool isOptimized() const;
     void initOptimalPrimitiveDescriptor() override;
+    void resolveInPlaceEdges() override;
 
     void setDynamicBatchLim(int lim) override;
     bool isExecutable() const override;
@@ -35,6 +35,8 @@ enum impl_desc_type {
     reorder = 1<<22,
     // winograd
     winograd = 1<<23,
+    // sparse
+    sparse = 1<<24,
 
     // real types
     ref_any             = ref  | any,
@@ -56,6 +58,9 @@ enum impl_desc_type {
     jit_uni             = jit  | uni,
     jit_avx512_amx      = jit  | avx512 | amx,
 
+    jit_avx512_sparse   = jit  | avx512 | sparse,
+    jit_avx2_sparse     = jit  | avx2   | sparse,
+
     jit_avx512_1x1      = jit  | avx512 | _1x1,
     jit_avx2_1x1        = jit  | avx2   | _1x1,
     jit_avx_1x1         = jit  | avx    | _1x1,
@@ -673,6 +673,26 @@ INSTANTIATE_TEST_SUITE_P(smoke_Concat_inPlace, ConcatLayerCPUTest,
                                 ::testing::Values(CPUSpecificParams{{}, {}, {}, "unknown"})),
                         ConcatLayerCPUTest::getTestCaseName);
 
+const std::vector<std::vector<InputShape>> inputShapes4D_inPlace_dynamic = {
+        {
+            {{1, 8, -1, -1}, {{1, 8, 5, 7}, {1, 8, 10, 2}, {1, 8, 3, 3}, {1, 8, 5, 7}}},
+            {{1, 16, -1, -1}, {{1, 16, 5, 7}, {1, 16, 10, 2}, {1, 16, 3, 3}, {1, 16, 5, 7}}},
+            {{1, 3, -1, -1}, {{1, 3, 5, 7}, {1, 3, 10, 2}, {1, 3, 3, 3}, {1, 3, 5, 7}}}
+        },
+        {
+            {{1, 8, {1, 10}, 4}, {{1, 8, 5, 4}, {1, 8, 10, 4}, {1, 8, 1, 4}}},
+            {{1, 16, {1, 10}, 4}, {{1, 16, 5, 4}, {1, 16, 10, 4}, {1, 16, 1, 4}}}
+        },
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_Concat4D_CPU_inPlace_dynamic, ConcatLayerCPUTest,
+                        ::testing::Combine(
+                                ::testing::Values(1),
+                                ::testing::ValuesIn(inputShapes4D_inPlace_dynamic),
+                                ::testing::ValuesIn(netPrecisions),
+                                ::testing::Values(planar_4D)),
+                        ConcatLayerCPUTest::getTestCaseName);
+
 } // namespace
 
 } // namespace CPULayerTestsDefinitions
\ No newline at end of file
@@ -247,6 +247,55 @@ TEST_P(DetectionOutputLayerCPUTest, CompareWithRefs) {
     run();
 }
 
+/* The priors are groups of four normalized boxes with the overlaps of exactly 0.5, 1/3 and 0.25 within a group and
+   the location offsets are zero, so the decoded boxes are the priors. The NMS threshold equal to an overlap checks
+   the strict comparison of the vectorized NMS without rounding errors. */
+class DetectionOutputOverlapLayerCPUTest : public DetectionOutputLayerCPUTest {
+protected:
+    void generate_inputs(const std::vector<ngraph::Shape>& targetInputStaticShapes) override {
+        static const float group[4][4] = {{0.f, 0.f, 0.5f, 0.5f},
+                                          {0.f, 0.f, 0.5f, 0.25f},
+                                          {0.f, 0.f, 0.25f, 0.5f},
+                                          {0.25f, 0.25f, 0.5f, 0.5f}};
+        inputs.clear();
+        const auto& funcInputs = function->inputs();
+        const auto& priorsShape = targetInputStaticShapes[idxPriors];
+        const auto& confShape = targetInputStaticShapes[idxConfidence];
+        const size_t priorsNum = priorsShape.back() / 4;
+        const size_t classesNum = confShape.back() / priorsNum;
+        for (auto i = 0ul; i < funcInputs.size(); ++i) {
+            ov::Tensor tensor(funcInputs[i].get_element_type(), targetInputStaticShapes[i]);
+            auto data = tensor.data<float>();
+            std::fill(data, data + tensor.get_size(), 0.f);
+            if (i == idxPriors) {
+                for (size_t p = 0; p < priorsNum; p++) {
+                    const float shift = static_cast<float>(p / 4);
+                    data[p * 4 + 0] = shift + group[p % 4][0];
+                    data[p * 4 + 1] = group[p % 4][1];
+                    data[p * 4 + 2] = shift + group[p % 4][2];
+                    data[p * 4 + 3] = group[p % 4][3];
+                }
+            } else if (i == idxConfidence) {
+                // distinct scores, the order of the boxes differs between the classes and the images
+                for (size_t n = 0; n < confShape[0]; n++) {
+                    for (size_t p = 0; p < priorsNum; p++) {
+                        for (size_t c = 0; c < classesNum; c++) {
+                            data[(n * priorsNum + p) * classesNum + c] =
+                                0.9f - 0.5f * ((p + c + n) % priorsNum) / priorsNum - 0.001f * c / classesNum;
+                        }
+                    }
+                }
+            }
+            inputs.insert({funcInputs[i].get_node_shared_ptr(), tensor});
+        }
+    }
+};
+
+TEST_P(DetectionOutputOverlapLayerCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+}
+
 namespace {
 
 const int numClasses = 11;
@@ -461,5 +510,46 @@ INSTANTIATE_TEST_SUITE_P(
         params5InputsDynamic,
         DetectionOutputLayerCPUTest::getTestCaseName);
 
+/* =============== overlaps equal to the NMS threshold =============== */
+
+const auto overlapAttributes = ::testing::Combine(
+    ::testing::Values(3),
+    ::testing::Values(backgroundLabelId),
+    ::testing::Values(20),
+    ::testing::Values(std::vector<int>{20}),
+    ::testing::Values("caffe.PriorBoxParameter.CORNER"),
+    ::testing::Values(0.5f, 0.25f, 0.3f),
+    ::testing::Values(confidenceThreshold),
+    ::testing::Values(false),
+    ::testing::Values(false),
+    ::testing::Values(false)
+);
+
+const std::vector<ParamsWhichSizeDependsDynamic> specificParamsOverlap = {
+    ParamsWhichSizeDependsDynamic {
+        true, true, true, 1, 1,
+        {{ov::Dimension::dynamic(), ov::Dimension::dynamic()}, {{2, 64}}},
+        {{ov::Dimension::dynamic(), ov::Dimension::dynamic()}, {{2, 48}}},
+        {{ov::Dimension::dynamic(), ov::Dimension::dynamic(), ov::Dimension::dynamic()}, {{1, 1, 64}}},
+        {},
+        {}
+    },
+};
+
+const auto paramsOverlap = ::testing::Combine(
+        overlapAttributes,
+        ::testing::ValuesIn(specificParamsOverlap),
+        ::testing::Values(2),
+        ::testing::Values(0.0f),
+        ::testing::Values(false),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+INSTANTIATE_TEST_SUITE_P(
+        smoke_CPUDetectionOutputOverlap,
+        DetectionOutputOverlapLayerCPUTest,
+        paramsOverlap,
+        DetectionOutputLayerCPUTest::getTestCaseName);
+
 }  // namespace
 }  // namespace CPULayerTestsDefinitions
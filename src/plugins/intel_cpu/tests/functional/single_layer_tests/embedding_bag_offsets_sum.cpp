@@ -164,5 +164,54 @@ INSTANTIATE_TEST_SUITE_P(smoke, EmbeddingBagOffsetsSumLayerCPUTest,
                 ::testing::ValuesIn(indPrecisions),
                 ::testing::Values(CommonTestUtils::DEVICE_CPU)),
         EmbeddingBagOffsetsSumLayerCPUTest::getTestCaseName);
+
+// The tables are read in bf16 and accumulated in f32 by the JIT kernels
+const std::vector<InputShape> bf16_input_shapes = {
+        {{ov::Dimension::dynamic(), ov::Dimension::dynamic()}, {{5, 6}, {10, 35}}},
+        {{5, 4, 16}, {{5, 4, 16}}},
+};
+
+// A few long bags load fewer threads than available, so the embedding depth is split between the threads.
+// The depth of 67 and 3 * 23 is not a multiple of the SIMD width, so the scalar tail is computed as well.
+const std::vector<InputShape> long_bags_input_shapes = {
+        {{20, 67}, {{20, 67}}},
+        {{20, 3, 23}, {{20, 3, 23}}},
+        {{ov::Dimension::dynamic(), ov::Dimension::dynamic()}, {{20, 67}, {20, 35}}},
+};
+
+std::vector<size_t> generateLongBagIndices(size_t size) {
+    std::vector<size_t> indices(size);
+    for (size_t i = 0; i < size; i++)
+        indices[i] = (i * 7) % 20;
+    return indices;
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_BF16Table, EmbeddingBagOffsetsSumLayerCPUTest,
+        ::testing::Combine(
+                ::testing::Combine(
+                        ::testing::ValuesIn(bf16_input_shapes),
+                        ::testing::ValuesIn(indices),
+                        ::testing::ValuesIn(offsets),
+                        ::testing::Values(0),
+                        ::testing::ValuesIn(with_weights),
+                        ::testing::ValuesIn(with_default_index)),
+                ::testing::Values(ElementType::bf16),
+                ::testing::Values(ElementType::i32),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+        EmbeddingBagOffsetsSumLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_LongBags, EmbeddingBagOffsetsSumLayerCPUTest,
+        ::testing::Combine(
+                ::testing::Combine(
+                        ::testing::ValuesIn(long_bags_input_shapes),
+                        ::testing::Values(generateLongBagIndices(64)),
+                        ::testing::Values(std::vector<size_t>{0, 40}),
+                        ::testing::Values(0),
+                        ::testing::ValuesIn(with_weights),
+                        ::testing::Values(false)),
+                ::testing::Values(ElementType::f32, ElementType::bf16),
+                ::testing::Values(ElementType::i32),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+        EmbeddingBagOffsetsSumLayerCPUTest::getTestCaseName);
 }  // namespace
 }  // namespace CPULayerTestsDefinitions
\ No newline at end of file
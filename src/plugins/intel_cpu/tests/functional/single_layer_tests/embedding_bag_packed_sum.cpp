@@ -148,5 +148,48 @@ INSTANTIATE_TEST_SUITE_P(smoke, EmbeddingBagPackedSumLayerCPUTest,
                 ::testing::ValuesIn(indPrecisions),
                 ::testing::Values(CommonTestUtils::DEVICE_CPU)),
         EmbeddingBagPackedSumLayerCPUTest::getTestCaseName);
+
+// The tables are read in bf16 and accumulated in f32 by the JIT kernels
+const std::vector<InputShape> bf16_input_shapes = {
+        {{ov::Dimension::dynamic(), ov::Dimension::dynamic()}, {{5, 6}, {10, 35}}},
+        {{5, 4, 16}, {{5, 4, 16}}},
+};
+
+// A few long bags load fewer threads than available, so the embedding depth is split between the threads.
+// The depth of 67 and 3 * 23 is not a multiple of the SIMD width, so the scalar tail is computed as well.
+const std::vector<InputShape> long_bags_input_shapes = {
+        {{20, 67}, {{20, 67}}},
+        {{20, 3, 23}, {{20, 3, 23}}},
+        {{ov::Dimension::dynamic(), ov::Dimension::dynamic()}, {{20, 67}, {20, 35}}},
+};
+
+std::vector<size_t> generateLongBagIndices(size_t size) {
+    std::vector<size_t> indices(size);
+    for (size_t i = 0; i < size; i++)
+        indices[i] = (i * 7) % 20;
+    return indices;
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_BF16Table, EmbeddingBagPackedSumLayerCPUTest,
+        ::testing::Combine(
+                ::testing::Combine(
+                        ::testing::ValuesIn(bf16_input_shapes),
+                        ::testing::ValuesIn(indices),
+                        ::testing::ValuesIn(with_weights)),
+                ::testing::Values(ElementType::bf16),
+                ::testing::Values(ElementType::i32),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+        EmbeddingBagPackedSumLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_LongBags, EmbeddingBagPackedSumLayerCPUTest,
+        ::testing::Combine(
+                ::testing::Combine(
+                        ::testing::ValuesIn(long_bags_input_shapes),
+                        ::testing::Values(std::vector<std::vector<size_t>>{generateLongBagIndices(32), generateLongBagIndices(32)}),
+                        ::testing::ValuesIn(with_weights)),
+                ::testing::Values(ElementType::f32, ElementType::bf16),
+                ::testing::Values(ElementType::i32),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+        EmbeddingBagPackedSumLayerCPUTest::getTestCaseName);
 }  // namespace
 }  // namespace CPULayerTestsDefinitions
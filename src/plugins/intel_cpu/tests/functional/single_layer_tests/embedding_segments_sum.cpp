@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <string>
 #include <sstream>
 #include <vector>
@@ -169,5 +170,63 @@ INSTANTIATE_TEST_SUITE_P(smoke, EmbeddingSegmentsSumLayerCPUTest,
          ::testing::ValuesIn(indPrecisions),
          ::testing::Values(CommonTestUtils::DEVICE_CPU)),
          EmbeddingSegmentsSumLayerCPUTest::getTestCaseName);
+
+// The tables are read in bf16 and accumulated in f32 by the JIT kernels
+const std::vector<InputShape> bf16_input_shapes = {
+    {{ov::Dimension::dynamic(), ov::Dimension::dynamic()}, {{5, 6}, {10, 35}}},
+    {{5, 4, 16}, {{5, 4, 16}}},
+};
+
+// A few long bags load fewer threads than available, so the embedding depth is split between the threads.
+// The depth of 67 and 3 * 23 is not a multiple of the SIMD width, so the scalar tail is computed as well.
+const std::vector<InputShape> long_bags_input_shapes = {
+    {{20, 67}, {{20, 67}}},
+    {{20, 3, 23}, {{20, 3, 23}}},
+    {{ov::Dimension::dynamic(), ov::Dimension::dynamic()}, {{20, 67}, {20, 35}}},
+};
+
+std::vector<size_t> generateLongBagIndices(size_t size) {
+    std::vector<size_t> indices(size);
+    for (size_t i = 0; i < size; i++)
+        indices[i] = (i * 7) % 20;
+    return indices;
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_BF16Table, EmbeddingSegmentsSumLayerCPUTest,
+    ::testing::Combine(
+        ::testing::Combine(
+            ::testing::ValuesIn(bf16_input_shapes),
+            ::testing::ValuesIn(indices),
+            ::testing::ValuesIn(segment_ids),
+            ::testing::Values(5),
+            ::testing::Values(0),
+            ::testing::ValuesIn(with_weights),
+            ::testing::ValuesIn(with_default_index)),
+        ::testing::Values(ElementType::bf16),
+        ::testing::Values(ElementType::i32),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+        EmbeddingSegmentsSumLayerCPUTest::getTestCaseName);
+
+// two segments of 32 indices each
+const std::vector<size_t> long_bags_segment_ids = [] {
+    std::vector<size_t> ids(64, 1);
+    std::fill(ids.begin(), ids.begin() + 32, 0);
+    return ids;
+}();
+
+INSTANTIATE_TEST_SUITE_P(smoke_LongBags, EmbeddingSegmentsSumLayerCPUTest,
+    ::testing::Combine(
+        ::testing::Combine(
+            ::testing::ValuesIn(long_bags_input_shapes),
+            ::testing::Values(generateLongBagIndices(64)),
+            ::testing::Values(long_bags_segment_ids),
+            ::testing::Values(2),
+            ::testing::Values(0),
+            ::testing::ValuesIn(with_weights),
+            ::testing::Values(false)),
+        ::testing::Values(ElementType::f32, ElementType::bf16),
+        ::testing::Values(ElementType::i32),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+        EmbeddingSegmentsSumLayerCPUTest::getTestCaseName);
 }  // namespace
 }  // namespace CPULayerTestsDefinitions
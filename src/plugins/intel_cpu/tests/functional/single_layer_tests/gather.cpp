@@ -6,6 +6,7 @@
 #include "ngraph_functions/builders.hpp"
 #include "test_utils/cpu_test_utils.hpp"
 #include <common_test_utils/ov_tensor_utils.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 
 using namespace CPUTestUtils;
 using namespace ov::test;
@@ -455,6 +456,20 @@ INSTANTIATE_TEST_SUITE_P(smoke_static_4D_jit8_Bmax, GatherLayerTestCPU,
                     ::testing::Values(additionalConfig[0])),
                 GatherLayerTestCPU::getTestCaseName);
 
+// The small static Gather is executed on fewer threads than the stream has, the work split must still cover the output.
+const std::map<std::string, std::string> workSizeAwareThreadingConfig =
+    {{InferenceEngine::PluginConfigInternalParams::KEY_CPU_WORK_SIZE_AWARE_THREADING, InferenceEngine::PluginConfigParams::YES}};
+
+INSTANTIATE_TEST_SUITE_P(smoke_static_4D_jit32_WorkSizeAwareThreading, GatherLayerTestCPU,
+                ::testing::Combine(
+                    ::testing::ValuesIn(get4DShapesJitStat(2)),
+                    ::testing::ValuesIn(get4DAxisBatchJitStat(ElementType::f32, 2)),
+                    ::testing::Values(ElementType::f32),
+                    ::testing::Values(true),
+                    ::testing::ValuesIn(getCPUInfo()),
+                    ::testing::Values(workSizeAwareThreadingConfig)),
+                GatherLayerTestCPU::getTestCaseName);
+
 
 std::vector<std::vector<ov::test::InputShape>> get4DShapesJitDyn(int maxBatchDims) {
     std::vector<std::vector<ov::test::InputShape>> result = {};
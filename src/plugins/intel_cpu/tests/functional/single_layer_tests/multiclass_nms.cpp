@@ -0,0 +1,100 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/single_layer/multiclass_nms.hpp"
+
+#include <vector>
+
+#include "common_test_utils/test_constants.hpp"
+
+using namespace ov::test;
+using namespace ov::test::subgraph;
+
+namespace CPULayerTestsDefinitions {
+
+/* The boxes are groups of four normalized boxes with the IoU of exactly 0.5, 1/3 and 0.25 within a group. The IoU
+   threshold equal to the IoU of some boxes checks the vectorized NMS suppresses them the same way as the reference
+   implementation, without rounding errors. */
+class MulticlassNmsOverlapLayerCPUTest : public MulticlassNmsLayerTest {
+public:
+    void generate_inputs(const std::vector<ngraph::Shape>& targetInputStaticShapes) override {
+        static const float group[4][4] = {{0.f, 0.f, 0.5f, 0.5f},
+                                          {0.f, 0.f, 0.5f, 0.25f},
+                                          {0.f, 0.f, 0.25f, 0.5f},
+                                          {0.25f, 0.25f, 0.5f, 0.5f}};
+        inputs.clear();
+        const auto& funcInputs = function->inputs();
+        ASSERT_EQ(2u, funcInputs.size()) << "Expected boxes and scores inputs.";
+
+        const auto& boxesShape = targetInputStaticShapes[0];
+        ov::Tensor boxes(funcInputs[0].get_element_type(), boxesShape);
+        auto boxesData = boxes.data<float>();
+        for (size_t n = 0; n < boxesShape[0]; n++) {
+            for (size_t i = 0; i < boxesShape[1]; i++) {
+                auto box = boxesData + (n * boxesShape[1] + i) * 4;
+                const float shift = static_cast<float>(i / 4);
+                box[0] = shift + group[i % 4][0];
+                box[1] = group[i % 4][1];
+                box[2] = shift + group[i % 4][2];
+                box[3] = group[i % 4][3];
+            }
+        }
+        inputs.insert({funcInputs[0].get_node_shared_ptr(), boxes});
+
+        // distinct scores, the order of the boxes differs between the classes and the batches
+        const auto& scoresShape = targetInputStaticShapes[1];
+        const size_t classesNum = scoresShape[1];
+        const size_t boxesNum = scoresShape[2];
+        ov::Tensor scores(funcInputs[1].get_element_type(), scoresShape);
+        auto scoresData = scores.data<float>();
+        for (size_t n = 0; n < scoresShape[0]; n++) {
+            for (size_t c = 0; c < classesNum; c++) {
+                for (size_t i = 0; i < boxesNum; i++) {
+                    scoresData[(n * classesNum + c) * boxesNum + i] =
+                        0.9f - 0.5f * ((i + c + n) % boxesNum) / boxesNum - 0.001f * c / classesNum;
+                }
+            }
+        }
+        inputs.insert({funcInputs[1].get_node_shared_ptr(), scores});
+    }
+};
+
+TEST_P(MulticlassNmsOverlapLayerCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+}
+
+namespace {
+
+const std::vector<std::vector<ov::Shape>> inStaticShapes = {
+    {{2, 16, 4}, {2, 3, 16}},
+    {{1, 64, 4}, {1, 2, 64}}
+};
+
+const std::vector<ov::op::util::MulticlassNmsBase::SortResultType> sortResultType = {
+    ov::op::util::MulticlassNmsBase::SortResultType::SCORE,
+    ov::op::util::MulticlassNmsBase::SortResultType::CLASSID};
+
+const auto nmsParamsOverlap = ::testing::Combine(
+    ::testing::ValuesIn(static_shapes_to_test_representation(inStaticShapes)),
+    ::testing::Combine(::testing::Values(ov::element::f32),
+                       ::testing::Values(ov::element::i32),
+                       ::testing::Values(ov::element::i32),
+                       ::testing::Values(ov::element::f32)),
+    ::testing::Values(-1, 5),
+    // iouThreshold equal to the IoU of some boxes, scoreThreshold, nmsEta
+    ::testing::Combine(::testing::Values(0.5f, 0.25f, 0.3f), ::testing::Values(0.3f), ::testing::Values(1.0f)),
+    ::testing::Values(-1),
+    ::testing::Values(-1),
+    ::testing::Values(ov::element::i32),
+    ::testing::ValuesIn(sortResultType),
+    // sortResultAcrossBatch, normalized
+    ::testing::Combine(::testing::Values(false, true), ::testing::Values(true)),
+    ::testing::Values(CommonTestUtils::DEVICE_CPU));
+
+INSTANTIATE_TEST_SUITE_P(smoke_MulticlassNmsOverlap, MulticlassNmsOverlapLayerCPUTest, nmsParamsOverlap,
+                         MulticlassNmsLayerTest::getTestCaseName);
+
+}  // namespace
+}  // namespace CPULayerTestsDefinitions
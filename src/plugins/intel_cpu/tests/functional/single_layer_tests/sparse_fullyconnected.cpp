@@ -0,0 +1,139 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+#include <random>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace CPULayerTestsDefinitions {
+
+using SparseFullyConnectedCPUTestParams = std::tuple<InputShape,  // data shape
+                                                     size_t,      // output channels
+                                                     bool,        // zeros cover whole output channels blocks
+                                                     float>;      // sparse weights decompression rate
+
+class SparseFullyConnectedCPUTest : public testing::WithParamInterface<SparseFullyConnectedCPUTestParams>,
+                                    virtual public SubgraphBaseTest, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<SparseFullyConnectedCPUTestParams>& obj) {
+        InputShape inputShape;
+        size_t OC;
+        bool blockSparse;
+        float minRate;
+        std::tie(inputShape, OC, blockSparse, minRate) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::partialShape2str({inputShape.first}) << "_";
+        result << "TS=";
+        for (const auto& shape : inputShape.second) {
+            result << "(" << CommonTestUtils::vec2str(shape) << ")_";
+        }
+        result << "OC=" << OC << "_";
+        result << (blockSparse ? "blockSparse" : "scatteredSparse") << "_";
+        result << "minRate=" << minRate;
+
+        return result.str();
+    }
+
+protected:
+    // the share of zero weights, the block sparse weights have the same packed sparse rate
+    const float zerosRate = 0.8f;
+
+    // the weights columns of every output channels block are zero together or, if blockSparse is false,
+    // the zeros are scattered so that almost no column is zero in a whole block
+    std::vector<float> generateWeights(size_t OC, size_t IC, size_t blk, bool blockSparse) const {
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<float> values(-1.f, 1.f);
+        std::bernoulli_distribution isZero(zerosRate);
+        std::vector<float> weights(OC * IC, 0.f);
+        for (size_t ob = 0; ob < OC; ob += blk) {
+            for (size_t ic = 0; ic < IC; ic++) {
+                const bool zeroColumn = isZero(gen);
+                for (size_t oc = ob; oc < std::min(OC, ob + blk); oc++) {
+                    if (!(blockSparse ? zeroColumn : isZero(gen)))
+                        weights[oc * IC + ic] = values(gen);
+                }
+            }
+        }
+        return weights;
+    }
+
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        InputShape inputShape;
+        size_t OC;
+        bool blockSparse;
+        float minRate;
+        std::tie(inputShape, OC, blockSparse, minRate) = this->GetParam();
+
+        init_input_shapes({inputShape});
+        configuration.insert(ov::intel_cpu::sparse_weights_decompression_rate(minRate));
+
+        const size_t blk = with_cpu_x86_avx512_core() ? 16 : 8;
+        const size_t IC = static_cast<size_t>(inputDynamicShapes[0].rbegin()->get_length());
+        const auto weights = generateWeights(OC, IC, blk, blockSparse);
+
+        expectSparse = blockSparse && zerosRate >= minRate;
+        selectedType = expectSparse ? makeSelectedTypeStr(blk == 16 ? "jit_avx512_sparse" : "jit_avx2_sparse", ElementType::f32)
+                                    : "dense";
+
+        auto params = builder::makeDynamicParams(ElementType::f32, {inputDynamicShapes[0]});
+        auto weightsNode = builder::makeConstant(ElementType::f32, {OC, IC}, weights);
+        auto matMul = builder::makeMatMul(params[0], weightsNode, false, true);
+        function = makeNgraphFunction(ElementType::f32, params, matMul, "SparseFullyConnected");
+    }
+
+    bool primTypeCheck(std::string primType) const override {
+        if (expectSparse)
+            return primType == selectedType;
+        return primType.find("sparse") == std::string::npos;
+    }
+
+    bool expectSparse = false;
+};
+
+TEST_P(SparseFullyConnectedCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    if (!with_cpu_x86_avx2())
+        GTEST_SKIP() << "The sparse FullyConnected kernel requires AVX2";
+
+    run();
+    CheckPluginRelatedResults(compiledModel, "FullyConnected");
+}
+
+namespace {
+
+const std::vector<InputShape> inputShapes = {
+    {{}, {{1, 64}}},
+    {{}, {{5, 64}}},
+    {{}, {{2, 3, 64}}},
+    {{-1, 64}, {{1, 64}, {9, 64}, {4, 64}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_SparseFullyConnected, SparseFullyConnectedCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(32, 45),
+                                            ::testing::Values(true, false),
+                                            ::testing::Values(0.7f)),
+                         SparseFullyConnectedCPUTest::getTestCaseName);
+
+// the rate is above the packed sparse rate of the weights, so the dense inner product is used
+INSTANTIATE_TEST_SUITE_P(smoke_SparseFullyConnected_AboveRate, SparseFullyConnectedCPUTest,
+                         ::testing::Combine(::testing::Values(inputShapes[1]),
+                                            ::testing::Values(32),
+                                            ::testing::Values(true),
+                                            ::testing::Values(0.95f)),
+                         SparseFullyConnectedCPUTest::getTestCaseName);
+
+} // namespace
+
+} // namespace CPULayerTestsDefinitions
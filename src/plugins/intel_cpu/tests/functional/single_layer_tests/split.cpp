@@ -550,6 +550,40 @@ INSTANTIATE_TEST_SUITE_P(smoke_Split5D_CPU_Block16inPlace, SplitLayerCPUTest,
                                 ::testing::Values(blocked16_5D)),
                         SplitLayerCPUTest::getTestCaseName);
 
+const std::vector<InputShape> inputShapes4D_inPlace_dynamic = {
+        {
+            // dynamic
+            {1, 6, -1, -1},
+            // target
+            {
+                {1, 6, 5, 7},
+                {1, 6, 10, 2},
+                {1, 6, 3, 3},
+                {1, 6, 5, 7}
+            }
+        },
+        {
+            // dynamic
+            {1, 1, 9, {1, 20}},
+            // target
+            {
+                {1, 1, 9, 4},
+                {1, 1, 9, 20},
+                {1, 1, 9, 1}
+            }
+        },
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_Split4D_CPU_inPlace_dynamic, SplitLayerCPUTest,
+                        ::testing::Combine(
+                                ::testing::Values(3),
+                                ::testing::Values(1, 2),
+                                ::testing::ValuesIn(netPrecisions),
+                                ::testing::ValuesIn(inputShapes4D_inPlace_dynamic),
+                                ::testing::ValuesIn(outIndices3),
+                                ::testing::Values(planar_4D)),
+                        SplitLayerCPUTest::getTestCaseName);
+
 } // namespace
 
 } // namespace CPULayerTestsDefinitions
\ No newline at end of file
@@ -0,0 +1,86 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include <ngraph/opsets/opset8.hpp>
+#include <ngraph_functions/builders.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+#include <exec_graph_info.hpp>
+#include <ie_system_conf.h>
+
+namespace SubgraphTestsDefinitions {
+
+using namespace ngraph;
+
+/*
+   Parameter    Parameter
+       |            |
+  Convolution       |
+       \           /
+        Multiply
+           |
+         Result
+
+   The convolution produces a blocked layout and the greedy selection makes Multiply follow it,
+   so the second Parameter and the Result need reorders. With CPU_LAYOUT_OPTIMIZATION Multiply
+   is switched to the planar layout and only the convolution output is reordered.
+*/
+class LayoutOptimizationTest : virtual public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration[InferenceEngine::PluginConfigInternalParams::KEY_CPU_LAYOUT_OPTIMIZATION] =
+            InferenceEngine::PluginConfigParams::YES;
+
+        const auto type = element::f32;
+        const Shape shape{1, 16, 10, 10};
+        auto params = builder::makeParams(type, {shape, shape});
+        auto conv = builder::makeConvolution(params[0], type, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                             op::PadType::EXPLICIT, 16);
+        auto multiply = std::make_shared<opset8::Multiply>(conv, params[1]);
+        function = std::make_shared<Function>(multiply, params, "LayoutOptimization");
+    }
+
+    static size_t countNodes(const std::shared_ptr<const ov::Model>& execModel, const std::string& type) {
+        size_t count = 0;
+        for (const auto& n : execModel->get_ops()) {
+            if (n->get_rt_info().at(ExecGraphInfoSerialization::LAYER_TYPE).as<std::string>() == type)
+                count++;
+        }
+        return count;
+    }
+};
+
+TEST_F(LayoutOptimizationTest, smoke_CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    if (!InferenceEngine::with_cpu_x86_sse42())
+        GTEST_SKIP();
+
+    Run();
+
+    const auto execModel = executableNetwork.GetExecGraphInfo().getFunction();
+    size_t multiplyNodes = 0;
+    for (const auto& n : execModel->get_ops()) {
+        const auto& rtInfo = n->get_rt_info();
+        const auto layerType = rtInfo.at(ExecGraphInfoSerialization::LAYER_TYPE).as<std::string>();
+        if (layerType == "Eltwise" || layerType == "Subgraph") {
+            multiplyNodes++;
+            ASSERT_EQ("abcd", rtInfo.at(ExecGraphInfoSerialization::OUTPUT_LAYOUTS).as<std::string>());
+        } else if (layerType == "Convolution") {
+            const auto layout = rtInfo.at(ExecGraphInfoSerialization::OUTPUT_LAYOUTS).as<std::string>();
+            ASSERT_TRUE(layout == "aBcd8b" || layout == "aBcd16b") << layout;
+        }
+    }
+    ASSERT_EQ(1, multiplyNodes);
+
+    // the greedy selection reorders the second input and the output, the optimized one only the convolution output
+    auto defaultConfig = configuration;
+    defaultConfig[InferenceEngine::PluginConfigInternalParams::KEY_CPU_LAYOUT_OPTIMIZATION] =
+        InferenceEngine::PluginConfigParams::NO;
+    auto defaultNetwork = getCore()->LoadNetwork(cnnNetwork, targetDevice, defaultConfig);
+    const auto defaultReorders = countNodes(defaultNetwork.GetExecGraphInfo().getFunction(), "Reorder");
+    ASSERT_EQ(defaultReorders - 1, countNodes(execModel, "Reorder"));
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,78 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+/* The output shapes of the dynamic nodes are cached per graph segment between the data dependent nodes.
+
+     Param
+     /    \
+   Abs   Multiply       <- segment defined by the input shapes
+    |      |
+  NonZero Result        <- data dependent node
+    |
+  Convert
+    |
+  Transpose             <- segment defined by the input shapes and the NonZero output shape
+    |
+  Relu
+    |
+  Result
+
+   The input shapes alternate as A, B, A, so the cached shapes are reused on the third inference. The last inference has
+   the shape A again, but another number of the nonzero elements, so only the first segment shapes may be reused.
+*/
+class OutputShapesCacheTest : public SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        InputShape inputShapes{{-1, -1}, {{4, 6}, {8, 3}, {4, 6}, {4, 6}}};
+        init_input_shapes({inputShapes});
+
+        auto params = ngraph::builder::makeDynamicParams(ngraph::element::f32, inputDynamicShapes);
+        auto abs = std::make_shared<ngraph::opset3::Abs>(params[0]);
+        auto nonZero = std::make_shared<ngraph::opset3::NonZero>(abs, ngraph::element::i32);
+        auto convert = std::make_shared<ngraph::opset3::Convert>(nonZero, ngraph::element::f32);
+        auto order = ngraph::builder::makeConstant<int>(ngraph::element::i32, {2}, {1, 0});
+        auto transpose = std::make_shared<ngraph::opset3::Transpose>(convert, order);
+        auto relu = std::make_shared<ngraph::opset3::Relu>(transpose);
+        auto multiply = std::make_shared<ngraph::opset3::Multiply>(params[0], params[0]);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset3::Result>(relu),
+                                     std::make_shared<ngraph::opset3::Result>(multiply)};
+        function = std::make_shared<ngraph::Function>(results, params, "OutputShapesCache");
+    }
+
+    void generate_inputs(const std::vector<ngraph::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& funcInput = function->inputs().front();
+        ov::Tensor tensor(funcInput.get_element_type(), targetInputStaticShapes.front());
+        // every third element is zero, the last inference zeroes every fourth one to change the nonzero elements number
+        const size_t step = inferNum == 3 ? 4 : 3;
+        auto data = tensor.data<float>();
+        for (size_t i = 0; i < tensor.get_size(); i++) {
+            data[i] = i % step == 0 ? 0.f : static_cast<float>(i % 7) - 3.5f;
+        }
+        inputs.insert({funcInput.get_node_shared_ptr(), tensor});
+        inferNum++;
+    }
+
+private:
+    size_t inferNum = 0;
+};
+
+TEST_F(OutputShapesCacheTest, smoke_AlternatingShapes) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,89 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <ngraph_functions/preprocess/preprocess_builders.hpp>
+#include <openvino/core/preprocess/pre_post_process.hpp>
+#include <exec_graph_info.hpp>
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+using PreprocessResizeU8Params = ov::preprocess::ResizeAlgorithm;
+
+// u8 NCHW image -> convert -> resize -> mean -> scale -> NCHW f32 model input.
+// The Convert is merged into Interpolate and mean/scale are fused into it, so the image is read once by the JIT resize.
+class PreprocessResizeU8Test : public testing::WithParamInterface<PreprocessResizeU8Params>,
+                               virtual public SubgraphBaseTest, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<PreprocessResizeU8Params>& obj) {
+        switch (obj.param) {
+        case ov::preprocess::ResizeAlgorithm::RESIZE_LINEAR:
+            return "resize=linear";
+        case ov::preprocess::ResizeAlgorithm::RESIZE_CUBIC:
+            return "resize=cubic";
+        default:
+            return "resize=nearest";
+        }
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        auto model = ov::builder::preprocess::create_preprocess_1input(ov::element::f32, ov::PartialShape{1, 3, 20, 20});
+        auto p = ov::preprocess::PrePostProcessor(model);
+        p.input().tensor().set_element_type(ov::element::u8).set_spatial_static_shape(40, 40).set_layout("NCHW");
+        p.input().preprocess()
+            .convert_element_type(ov::element::f32)
+            .resize(GetParam())
+            .mean({123.675f, 116.28f, 103.53f})
+            .scale({58.395f, 57.12f, 57.375f});
+        p.input().model().set_layout("NCHW");
+        function = p.build();
+
+        init_input_shapes(static_shapes_to_test_representation({ov::Shape{1, 3, 40, 40}}));
+    }
+
+    void CheckResizeNode() {
+        CheckNumberOfNodesWithType(compiledModel, "Convert", 0);
+        CheckNumberOfNodesWithType(compiledModel, "Eltwise", 0);
+        CheckNumberOfNodesWithType(compiledModel, "Subgraph", 0);
+
+        size_t interpolateNodes = 0;
+        for (const auto& node : compiledModel.get_runtime_model()->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            if (rtInfo.at(ExecGraphInfoSerialization::LAYER_TYPE).as<std::string>() != "Interpolate")
+                continue;
+            interpolateNodes++;
+            const auto implType = rtInfo.at(ExecGraphInfoSerialization::IMPL_TYPE).as<std::string>();
+            ASSERT_NE(std::string::npos, implType.find("jit")) << "Unexpected Interpolate implementation: " << implType;
+            // the converted image, the resize and the mean/scale operations are executed by the one node
+            const auto originalNames = rtInfo.at(ExecGraphInfoSerialization::ORIGINAL_NAMES).as<std::string>();
+            ASSERT_GE(std::count(originalNames.begin(), originalNames.end(), ','), 3)
+                << "Unexpected fused operations: " << originalNames;
+        }
+        ASSERT_EQ(1u, interpolateNodes);
+    }
+};
+
+TEST_P(PreprocessResizeU8Test, smoke_ConvertMergedIntoInterpolate) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    if (!InferenceEngine::with_cpu_x86_sse42())
+        GTEST_SKIP() << "Interpolate JIT kernels are not available";
+
+    run();
+    CheckResizeNode();
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_PreprocessResizeU8, PreprocessResizeU8Test,
+                         ::testing::Values(ov::preprocess::ResizeAlgorithm::RESIZE_LINEAR,
+                                           ov::preprocess::ResizeAlgorithm::RESIZE_CUBIC,
+                                           ov::preprocess::ResizeAlgorithm::RESIZE_NEAREST),
+                         PreprocessResizeU8Test::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,82 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <iostream>
+
+#include "openvino/openvino.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+namespace SubgraphTestsDefinitions {
+
+namespace {
+/* A chain of small Gather and Add nodes, similar to a decoder step, where the fork/join of all the stream threads
+   takes longer than the nodes execution itself.
+
+   Param -> [Gather -> Add] x chainLength -> Result
+*/
+std::shared_ptr<ov::Model> makeSmallGatherChain(size_t chainLength) {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{64, 64});
+    std::shared_ptr<ov::Node> last = param;
+    for (size_t i = 0; i < chainLength; i++) {
+        std::vector<int32_t> indicesData(64);
+        for (size_t j = 0; j < indicesData.size(); j++)
+            indicesData[j] = static_cast<int32_t>((j * 7 + i) % 64);
+        auto indices = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{indicesData.size()}, indicesData);
+        auto axis = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{}, {static_cast<int32_t>(i % 2)});
+        auto gather = std::make_shared<ov::op::v8::Gather>(last, indices, axis);
+        last = std::make_shared<ov::op::v1::Add>(gather, param);
+    }
+    return std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(last)},
+                                       ov::ParameterVector{param}, "SmallGatherChain");
+}
+
+// Returns the mean latency of the inference in microseconds, the output of the last one is stored into the result tensor
+double measureLatency(ov::Core& core, const std::shared_ptr<ov::Model>& model, const std::string& workSizeAwareThreading,
+                      const ov::Tensor& input, ov::Tensor& result) {
+    constexpr size_t warmupIters = 100;
+    constexpr size_t iters = 2000;
+
+    auto compiledModel = core.compile_model(model, CommonTestUtils::DEVICE_CPU,
+        {{InferenceEngine::PluginConfigInternalParams::KEY_CPU_WORK_SIZE_AWARE_THREADING, workSizeAwareThreading},
+         {ov::hint::performance_mode.name(), ov::hint::PerformanceMode::LATENCY}});
+    auto request = compiledModel.create_infer_request();
+    request.set_input_tensor(input);
+    for (size_t i = 0; i < warmupIters; i++)
+        request.infer();
+
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iters; i++)
+        request.infer();
+    const auto end = std::chrono::steady_clock::now();
+
+    const auto output = request.get_output_tensor();
+    result = ov::Tensor(output.get_element_type(), output.get_shape());
+    output.copy_to(result);
+    return std::chrono::duration<double, std::micro>(end - start).count() / iters;
+}
+} // namespace
+
+// The benchmark compares the latency of a model made of small nodes with the work size aware threading switched off
+// and on. It is disabled by default, run it with --gtest_also_run_disabled_tests.
+TEST(WorkSizeAwareThreadingBenchmark, DISABLED_SmallGatherChainLatency) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    ov::Core core;
+    const auto model = makeSmallGatherChain(32);
+    const auto input = ov::test::utils::create_and_fill_tensor(ov::element::f32, ov::Shape{64, 64});
+
+    ov::Tensor allThreadsResult, limitedThreadsResult;
+    const double allThreadsLatency = measureLatency(core, model, InferenceEngine::PluginConfigParams::NO, input, allThreadsResult);
+    const double limitedThreadsLatency = measureLatency(core, model, InferenceEngine::PluginConfigParams::YES, input, limitedThreadsResult);
+
+    ov::test::utils::compare(allThreadsResult, limitedThreadsResult, 0., 0.);
+    std::cout << "[ BENCHMARK ] all stream threads: " << allThreadsLatency << " us, "
+              << "work size aware threads: " << limitedThreadsLatency << " us" << std::endl;
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -6,6 +6,7 @@
 #include <gtest/gtest.h>
 
 #include <cpu_memory.h>
+#include "memory_desc/cpu_blocked_memory_desc.h"
 
 using namespace ov::intel_cpu;
 using namespace InferenceEngine;
@@ -17,3 +18,33 @@ TEST(MemoryTest, SedDataCheck) {
 TEST(MemoryTest, SedDataWithAutoPadCheck) {
     GTEST_SKIP();
 }
+
+TEST(MemoryTest, PartitionedMemoryMngr) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto baseMngr = std::make_shared<DnnlMemoryMngr>(std::unique_ptr<MemoryMngrWithReuse>(new MemoryMngrWithReuse()));
+    Memory baseMem(eng);
+    baseMem.Create(CpuBlockedMemoryDesc(Precision::FP32, Shape(VectorDims{1, 6, 2})), baseMngr);
+
+    // {1, 1, 2} + {1, 3, 2} + {1, 2, 2} parts of {1, 6, 2}
+    const std::vector<size_t> chunks = {1, 3, 2};
+    std::vector<std::unique_ptr<Memory>> parts;
+    size_t offset = 0;
+    for (auto chunk : chunks) {
+        parts.emplace_back(new Memory(eng));
+        parts.back()->Create(CpuBlockedMemoryDesc(Precision::FP32, Shape(VectorDims{1, chunk, 2})),
+                             baseMngr->createPartition(6, offset, chunk));
+        ASSERT_EQ(static_cast<float*>(baseMem.GetPtr()) + offset * 2, parts.back()->GetPtr());
+        offset += chunk;
+    }
+
+    // the parent buffer is reallocated and the parts offsets are scaled by the inner dims
+    baseMem.redefineDesc(std::make_shared<CpuBlockedMemoryDesc>(Precision::FP32, Shape(VectorDims{1, 6, 1000})));
+    offset = 0;
+    for (size_t i = 0; i < chunks.size(); i++) {
+        ASSERT_EQ(static_cast<float*>(baseMem.GetPtr()) + offset * 2, parts[i]->GetPtr());
+        ASSERT_EQ(static_cast<float*>(baseMem.GetPtr()) + offset * 2, parts[i]->GetPrimitive().get_data_handle());
+        parts[i]->redefineDesc(std::make_shared<CpuBlockedMemoryDesc>(Precision::FP32, Shape(VectorDims{1, chunks[i], 1000})));
+        ASSERT_EQ(static_cast<float*>(baseMem.GetPtr()) + offset * 1000, parts[i]->GetPtr());
+        offset += chunks[i];
+    }
+}
@@ -0,0 +1,107 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <nodes/kernels/embedding_bag_kernel.hpp>
+#include <utils/bfloat16.hpp>
+#include <random>
+#include <memory>
+#include <vector>
+
+using namespace ov::intel_cpu;
+using namespace dnnl::impl::cpu::x64;
+
+namespace {
+
+std::unique_ptr<jit_emb_bag_kernel> createKernel(InferenceEngine::Precision prc, size_t vecs, size_t& simd) {
+    std::unique_ptr<jit_emb_bag_kernel> kernel;
+    if (mayiuse(avx512_core)) {
+        kernel.reset(new jit_emb_bag_kernel_f32<avx512_core>(prc, vecs));
+        simd = cpu_isa_traits<avx512_core>::vlen / sizeof(float);
+    } else if (mayiuse(avx2)) {
+        kernel.reset(new jit_emb_bag_kernel_f32<avx2>(prc, vecs));
+        simd = cpu_isa_traits<avx2>::vlen / sizeof(float);
+    } else {
+        return nullptr;
+    }
+    kernel->create_ker();
+    return kernel;
+}
+
+}  // namespace
+
+TEST(EmbeddingBagKernelTest, WeightedSumF32) {
+    const size_t vecs = 3;
+    size_t simd = 0;
+    auto kernel = createKernel(InferenceEngine::Precision::FP32, vecs, simd);
+    if (!kernel)
+        GTEST_SKIP();
+
+    const size_t rows = 100, depth = vecs * simd + 5;
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> values(-1.f, 1.f);
+    std::uniform_int_distribution<int32_t> rowIdx(0, rows - 1);
+
+    std::vector<float> table(rows * depth);
+    for (auto& v : table)
+        v = values(gen);
+    std::vector<int32_t> indices(37);
+    std::vector<float> weights(indices.size());
+    for (size_t i = 0; i < indices.size(); i++) {
+        indices[i] = rowIdx(gen);
+        weights[i] = values(gen);
+    }
+
+    const size_t offset = 2;
+    std::vector<float> dst(vecs * simd, 0.f);
+    jit_emb_bag_call_args args;
+    args.table = table.data() + offset;
+    args.indices = indices.data();
+    args.weights = weights.data();
+    args.dst = dst.data();
+    args.row_stride = depth * sizeof(float);
+    args.weights_stride = sizeof(float);
+    args.num_indices = indices.size();
+    (*kernel)(&args);
+
+    for (size_t d = 0; d < dst.size(); d++) {
+        float ref = 0.f;
+        for (size_t i = 0; i < indices.size(); i++)
+            ref += table[indices[i] * depth + offset + d] * weights[i];
+        ASSERT_NEAR(ref, dst[d], 1e-4f) << "d = " << d;
+    }
+}
+
+TEST(EmbeddingBagKernelTest, SumBF16) {
+    const size_t vecs = 2;
+    size_t simd = 0;
+    auto kernel = createKernel(InferenceEngine::Precision::BF16, vecs, simd);
+    if (!kernel)
+        GTEST_SKIP();
+
+    const size_t rows = 10, depth = vecs * simd;
+    std::vector<bfloat16_t> table(rows * depth);
+    for (size_t i = 0; i < table.size(); i++)
+        table[i] = static_cast<float>(i % 7) - 3.f;
+    const std::vector<int32_t> indices = {3, 0, 9, 3, 5, 1, 8};
+
+    const float one = 1.f;
+    std::vector<float> dst(depth, 0.f);
+    jit_emb_bag_call_args args;
+    args.table = table.data();
+    args.indices = indices.data();
+    args.weights = &one;
+    args.dst = dst.data();
+    args.row_stride = depth * sizeof(bfloat16_t);
+    args.weights_stride = 0;
+    args.num_indices = indices.size();
+    (*kernel)(&args);
+
+    for (size_t d = 0; d < depth; d++) {
+        float ref = 0.f;
+        for (auto idx : indices)
+            ref += static_cast<float>(table[idx * depth + d]);
+        ASSERT_FLOAT_EQ(ref, dst[d]) << "d = " << d;
+    }
+}
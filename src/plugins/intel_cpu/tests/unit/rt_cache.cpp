@@ -9,6 +9,7 @@
 
 #include "cache/lru_cache.h"
 #include "cache/multi_cache.h"
+#include "cache/output_shapes_cache.h"
 
 using namespace ov::intel_cpu;
 
@@ -379,3 +380,73 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+namespace {
+// Emulates the graph inference: the segment [0, 2) is followed by a data dependent node with the nonzero elements
+// number as the output dim and the segment [3, 5), its shapes depend on both the input and the data dependent dims.
+void inferSegments(OutputShapesCache& cache, const VectorDims& inputDims, size_t nonZeroNum) {
+    OutputShapesCache::Key key;
+    key.dims = {inputDims};
+
+    key.segmentStart = 0;
+    const OutputShapesCache::SegmentShapes firstSegment = {{inputDims}, {inputDims}};
+    auto cached = cache.get(key);
+    if (cached) {
+        ASSERT_EQ(*cached, firstSegment);
+    } else {
+        cache.put(key, std::make_shared<OutputShapesCache::SegmentShapes>(firstSegment));
+    }
+
+    key.dims.push_back({inputDims.size(), nonZeroNum});
+    key.segmentStart = 3;
+    const OutputShapesCache::SegmentShapes secondSegment = {{{nonZeroNum}}, {{inputDims[0], nonZeroNum}}};
+    cached = cache.get(key);
+    if (cached) {
+        ASSERT_EQ(*cached, secondSegment);
+    } else {
+        cache.put(key, std::make_shared<OutputShapesCache::SegmentShapes>(secondSegment));
+    }
+}
+} // namespace
+
+TEST(OutputShapesCacheTests, AlternatingShapes) {
+    OutputShapesCache cache(10);
+    const VectorDims shapeA = {1, 3, 16};
+    const VectorDims shapeB = {2, 5, 8};
+
+    inferSegments(cache, shapeA, 7);
+    ASSERT_EQ(cache.hits(), 0u);
+    ASSERT_EQ(cache.misses(), 2u);
+
+    inferSegments(cache, shapeB, 7);
+    ASSERT_EQ(cache.hits(), 0u);
+    ASSERT_EQ(cache.misses(), 4u);
+
+    inferSegments(cache, shapeA, 7);
+    ASSERT_EQ(cache.hits(), 2u);
+    ASSERT_EQ(cache.misses(), 4u);
+
+    // the same input shapes, but the data dependent dims differ, so only the first segment is reused
+    inferSegments(cache, shapeA, 11);
+    ASSERT_EQ(cache.hits(), 3u);
+    ASSERT_EQ(cache.misses(), 5u);
+
+    inferSegments(cache, shapeB, 7);
+    ASSERT_EQ(cache.hits(), 5u);
+    ASSERT_EQ(cache.misses(), 5u);
+}
+
+TEST(OutputShapesCacheTests, SegmentStartIsPartOfKey) {
+    OutputShapesCache cache(10);
+    OutputShapesCache::Key key;
+    key.dims = {{1, 3, 16}};
+    key.segmentStart = 0;
+    cache.put(key, std::make_shared<OutputShapesCache::SegmentShapes>(OutputShapesCache::SegmentShapes{{{1, 3, 16}}}));
+
+    key.segmentStart = 4;
+    ASSERT_EQ(cache.get(key), nullptr);
+    key.segmentStart = 0;
+    ASSERT_NE(cache.get(key), nullptr);
+    ASSERT_EQ(cache.hits(), 1u);
+    ASSERT_EQ(cache.misses(), 1u);
+}
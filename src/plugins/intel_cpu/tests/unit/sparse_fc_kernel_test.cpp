@@ -0,0 +1,234 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <nodes/kernels/sparse_fc_kernel.hpp>
+#include <dnnl.hpp>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <tuple>
+#include <memory>
+#include <vector>
+
+using namespace ov::intel_cpu;
+using namespace dnnl::impl::cpu::x64;
+
+namespace {
+
+std::vector<float> generateSparseData(size_t size, float sparseRate, std::mt19937& gen) {
+    std::uniform_real_distribution<float> values(-1.f, 1.f);
+    std::bernoulli_distribution isZero(sparseRate);
+    std::vector<float> data(size);
+    for (auto& v : data)
+        v = isZero(gen) ? 0.f : values(gen);
+    return data;
+}
+
+// the input channels of every output channels block are zero with the given rate, so the rate is the packed one
+std::vector<float> generateBlockSparseWeights(size_t OC, size_t IC, size_t blk, float sparseRate, std::mt19937& gen) {
+    std::uniform_real_distribution<float> values(-1.f, 1.f);
+    std::bernoulli_distribution isZero(sparseRate);
+    std::vector<float> weights(OC * IC, 0.f);
+    for (size_t ob = 0; ob < OC; ob += blk) {
+        for (size_t ic = 0; ic < IC; ic++) {
+            if (isZero(gen))
+                continue;
+            for (size_t oc = ob; oc < std::min(OC, ob + blk); oc++)
+                weights[oc * IC + ic] = values(gen);
+        }
+    }
+    return weights;
+}
+
+template <typename F>
+double measureMs(size_t iterations, const F& f) {
+    f();
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; i++)
+        f();
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count() / iterations;
+}
+
+std::vector<std::unique_ptr<jit_sparse_fc_kernel>> createKernels(size_t blk) {
+    std::vector<std::unique_ptr<jit_sparse_fc_kernel>> kernels;
+    for (size_t rows = 1; rows <= jit_sparse_fc_kernel::max_rows; rows++) {
+        if (blk == 16) {
+            kernels.emplace_back(new jit_sparse_fc_kernel_f32<avx512_core>(rows));
+        } else {
+            kernels.emplace_back(new jit_sparse_fc_kernel_f32<avx2>(rows));
+        }
+        kernels.back()->create_ker();
+    }
+    return kernels;
+}
+
+}  // namespace
+
+TEST(SparseFCKernelTest, SparseRate) {
+    // 5 of 8 values are zero, but only the columns zero in a whole output channels block are skipped
+    const std::vector<float> weights = {0.f, 1.f, 0.f, 0.f,
+                                        2.f, 0.f, 0.f, 3.f};
+    const size_t OC = 2, IC = 4;
+    ASSERT_FLOAT_EQ(SparseFCWeights::getSparseRate(weights.data(), OC, IC, 1), 0.625f);
+    ASSERT_FLOAT_EQ(SparseFCWeights::getSparseRate(weights.data(), OC, IC, 2), 0.25f);
+    ASSERT_FLOAT_EQ(SparseFCWeights::getSparseRate(weights.data(), OC, IC, 16), 0.25f);
+}
+
+TEST(SparseFCKernelTest, PackAndExecute) {
+    const size_t blk = SparseFCWeights::getBlockSize();
+    if (blk == 0)
+        GTEST_SKIP();
+
+    const size_t M = 7, IC = 50, OC = 2 * blk + 5;
+    std::mt19937 gen(42);
+    const auto src = generateSparseData(M * IC, 0.f, gen);
+    const auto weights = generateSparseData(OC * IC, 0.8f, gen);
+    const auto bias = generateSparseData(OC, 0.f, gen);
+
+    std::vector<uint8_t> packed(SparseFCWeights::getPackedSize(weights.data(), OC, IC, blk) + 64);
+    auto* packedPtr = reinterpret_cast<void*>((reinterpret_cast<uintptr_t>(packed.data()) + 63) & ~uintptr_t(63));
+    SparseFCWeights::pack(weights.data(), bias.data(), OC, IC, blk, packedPtr);
+    const SparseFCWeights sparse(packedPtr, OC, blk);
+
+    std::unique_ptr<jit_sparse_fc_kernel> kernel;
+    if (blk == 16) {
+        kernel.reset(new jit_sparse_fc_kernel_f32<avx512_core>(1));
+    } else {
+        kernel.reset(new jit_sparse_fc_kernel_f32<avx2>(1));
+    }
+    kernel->create_ker();
+
+    const size_t ocBlocks = (OC + blk - 1) / blk;
+    std::vector<float> dst(M * ocBlocks * blk, 0.f);
+    for (size_t m = 0; m < M; m++) {
+        for (size_t ob = 0; ob < ocBlocks; ob++) {
+            jit_sparse_fc_call_args args;
+            args.src = src.data() + m * IC;
+            args.values = sparse.values + sparse.blkOffsets[ob] * blk;
+            args.ic_offsets = sparse.icOffsets + sparse.blkOffsets[ob];
+            args.bias = sparse.bias + ob * blk;
+            args.dst = dst.data() + m * ocBlocks * blk + ob * blk;
+            args.src_stride = IC * sizeof(float);
+            args.dst_stride = ocBlocks * blk * sizeof(float);
+            args.nnz = sparse.blkOffsets[ob + 1] - sparse.blkOffsets[ob];
+            (*kernel)(&args);
+        }
+    }
+
+    for (size_t m = 0; m < M; m++) {
+        for (size_t oc = 0; oc < OC; oc++) {
+            float ref = bias[oc];
+            for (size_t ic = 0; ic < IC; ic++)
+                ref += src[m * IC + ic] * weights[oc * IC + ic];
+            ASSERT_NEAR(ref, dst[m * ocBlocks * blk + oc], 1e-4f) << "m = " << m << ", oc = " << oc;
+        }
+    }
+}
+
+using SparseFCExecuteParams = std::tuple<size_t,   // rows (M)
+                                         size_t>;  // output channels tail (OC % blk)
+
+class SparseFCExecuteTest : public ::testing::TestWithParam<SparseFCExecuteParams> {};
+
+TEST_P(SparseFCExecuteTest, MatchesReference) {
+    const size_t blk = SparseFCWeights::getBlockSize();
+    if (blk == 0)
+        GTEST_SKIP();
+
+    size_t M, ocTail;
+    std::tie(M, ocTail) = GetParam();
+    const size_t IC = 37, OC = 2 * blk + ocTail;
+    std::mt19937 gen(7);
+    const auto src = generateSparseData(M * IC, 0.f, gen);
+    const auto weights = generateSparseData(OC * IC, 0.7f, gen);
+    const auto bias = generateSparseData(OC, 0.f, gen);
+
+    std::vector<uint8_t> packed(SparseFCWeights::getPackedSize(weights.data(), OC, IC, blk) + 64);
+    auto* packedPtr = reinterpret_cast<void*>((reinterpret_cast<uintptr_t>(packed.data()) + 63) & ~uintptr_t(63));
+    SparseFCWeights::pack(weights.data(), bias.data(), OC, IC, blk, packedPtr);
+    const SparseFCWeights sparse(packedPtr, OC, blk);
+
+    // the guard values after the output check the tail is not written out of bounds
+    const float guard = 123.f;
+    std::vector<float> dst(M * OC + blk, guard);
+    executeSparseFC(createKernels(blk), sparse, src.data(), dst.data(), M, IC, OC, blk);
+
+    for (size_t m = 0; m < M; m++) {
+        for (size_t oc = 0; oc < OC; oc++) {
+            float ref = bias[oc];
+            for (size_t ic = 0; ic < IC; ic++)
+                ref += src[m * IC + ic] * weights[oc * IC + ic];
+            ASSERT_NEAR(ref, dst[m * OC + oc], 1e-4f) << "m = " << m << ", oc = " << oc;
+        }
+    }
+    for (size_t i = M * OC; i < dst.size(); i++)
+        ASSERT_EQ(guard, dst[i]) << "out of bounds write at " << i;
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_SparseFC, SparseFCExecuteTest,
+                         ::testing::Combine(::testing::Values(1, 2, 3, 4, 5, 9),
+                                            ::testing::Values(0, 1, 5)));
+
+// Prints the time of the sparse kernel and of the dense oneDNN inner product for several packed sparse rates to find
+// the crossover rate for CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE. Run it with --gtest_also_run_disabled_tests.
+TEST(SparseFCKernelTest, DISABLED_BenchmarkAgainstInnerProduct) {
+    const size_t blk = SparseFCWeights::getBlockSize();
+    if (blk == 0)
+        GTEST_SKIP();
+
+    using dims = dnnl::memory::dims;
+    using dt = dnnl::memory::data_type;
+    using tag = dnnl::memory::format_tag;
+
+    const size_t IC = 1024, OC = 1024, iterations = 100;
+    const dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    dnnl::stream strm(eng);
+    const auto kernels = createKernels(blk);
+    std::mt19937 gen(1);
+
+    for (size_t M : {1, 4, 16, 64}) {
+        const auto src = generateSparseData(M * IC, 0.f, gen);
+        std::vector<float> dst(M * OC);
+        const auto srcDims = dims{static_cast<dnnl::memory::dim>(M), static_cast<dnnl::memory::dim>(IC)};
+        const auto weiDims = dims{static_cast<dnnl::memory::dim>(OC), static_cast<dnnl::memory::dim>(IC)};
+        const auto dstDims = dims{static_cast<dnnl::memory::dim>(M), static_cast<dnnl::memory::dim>(OC)};
+
+        for (float rate : {0.f, 0.5f, 0.6f, 0.7f, 0.8f, 0.9f, 0.95f}) {
+            auto weights = generateBlockSparseWeights(OC, IC, blk, rate, gen);
+
+            // dense inner product with the weights reordered to the layout chosen by oneDNN, as the node does
+            const dnnl::inner_product_forward::desc ipDesc(dnnl::prop_kind::forward_scoring,
+                                                           dnnl::memory::desc(srcDims, dt::f32, tag::nc),
+                                                           dnnl::memory::desc(weiDims, dt::f32, tag::any),
+                                                           dnnl::memory::desc(dstDims, dt::f32, tag::nc));
+            const dnnl::inner_product_forward::primitive_desc ipPd(ipDesc, eng);
+            dnnl::memory srcMem(ipPd.src_desc(), eng, const_cast<float*>(src.data()));
+            dnnl::memory plainWeiMem(dnnl::memory::desc(weiDims, dt::f32, tag::oi), eng, weights.data());
+            dnnl::memory weiMem(ipPd.weights_desc(), eng);
+            dnnl::reorder(plainWeiMem, weiMem).execute(strm, plainWeiMem, weiMem);
+            dnnl::memory dstMem(ipPd.dst_desc(), eng, dst.data());
+            const dnnl::inner_product_forward ip(ipPd);
+            const double denseMs = measureMs(iterations, [&] {
+                ip.execute(strm, {{DNNL_ARG_SRC, srcMem}, {DNNL_ARG_WEIGHTS, weiMem}, {DNNL_ARG_DST, dstMem}});
+                strm.wait();
+            });
+
+            std::vector<uint8_t> packed(SparseFCWeights::getPackedSize(weights.data(), OC, IC, blk) + 64);
+            auto* packedPtr = reinterpret_cast<void*>((reinterpret_cast<uintptr_t>(packed.data()) + 63) & ~uintptr_t(63));
+            SparseFCWeights::pack(weights.data(), nullptr, OC, IC, blk, packedPtr);
+            const SparseFCWeights sparse(packedPtr, OC, blk);
+            const double sparseMs = measureMs(iterations, [&] {
+                executeSparseFC(kernels, sparse, src.data(), dst.data(), M, IC, OC, blk);
+            });
+
+            std::cout << "M = " << M << ", IC = " << IC << ", OC = " << OC
+                      << ", sparse rate = " << SparseFCWeights::getSparseRate(weights.data(), OC, IC, blk)
+                      << ": dense " << denseMs << " ms, sparse " << sparseMs << " ms, speedup "
+                      << denseMs / sparseMs << std::endl;
+        }
+    }
+}
@@ -7,7 +7,10 @@
 #include <cstdint>
 #include <cstdio>
 
+#include <ie_parallel.hpp>
+
 #include "cnn.h"
+#include "floatmath.h"
 #include "backend/dnn_types.h"
 #include "backend/gna_limitations.hpp"
 #include "frontend/quantization.hpp"
@@ -38,15 +41,19 @@ void CNNFilter32(intel_dnn_component_t *component) {
         THROW_GNA_EXCEPTION << "Bad num_columns_out in CNNFilter32!" << layer_name;
     }
 
-    for (uint32_t j = 0; j < numberOfOutputsPerFilter; j++, input += convolutionStride, output += numberOfFilters) {
-        auto filter = filters;
-        for (uint32_t i = 0; i < numberOfFilters; i++, filter += filterSize) {
-            output[i] = biases[i];
-            for (uint32_t k = 0; k < filterSize; k++) {
-                output[i] += input[k] * filter[k];
+    const auto nthr = GNAPluginNS::runtime::GetWorkThreads(static_cast<size_t>(numberOfOutputsPerFilter) * numberOfFilters * filterSize);
+    InferenceEngine::parallel_nt(nthr, [&](const int ithr, const int nthr) {
+        uint32_t start = 0, end = 0;
+        InferenceEngine::splitter(numberOfOutputsPerFilter, static_cast<uint32_t>(nthr), static_cast<uint32_t>(ithr), start, end);
+        for (uint32_t j = start; j < end; j++) {
+            const auto in = input + j * convolutionStride;
+            const auto out = output + j * numberOfFilters;
+            auto filter = filters;
+            for (uint32_t i = 0; i < numberOfFilters; i++, filter += filterSize) {
+                out[i] = biases[i] + sdot(filterSize, in, filter);
             }
         }
-    }
+    });
 }
 
 namespace {
@@ -204,21 +211,19 @@ float CNN2DFilter32SingleHWC(const float bias, const float* filter, const unsign
     const auto zPW = zeroPadding[1];
     float output = 0;
     for (unsigned kh = 0; kh < KH; kh++) {
+        if (matchesPaddedArea(kh, oh, IH, zPH, cSH)) {
+            continue;
+        }
+        const auto ih = (cSH * oh + kh) - zPH;
         for (unsigned kw = 0; kw < KW; kw++) {
-            for (unsigned kc = 0; kc < KC; kc++) {
-                if (!matchesPaddedArea(kh, oh, IH, zPH, cSH) &&
-                    !matchesPaddedArea(kw, ow, IW, zPW, cSW)) {
-                    const auto ih = (cSH * oh + kh) - zPH;
-                    const auto iw = (cSW * ow + kw) - zPW;
-                    const auto ic = kc;
-                    const auto imageIndex = getQubeIndex(ih, iw, ic, IW, IC);
-                    const auto imageElement = image[imageIndex];
-                    const auto filterIndex = getQubeIndex(kh, kw, kc, KW, KC);
-                    const auto filterElement = filter[filterIndex];
-                    const auto product = imageElement * filterElement;
-                    output += product;
-                }
+            if (matchesPaddedArea(kw, ow, IW, zPW, cSW)) {
+                continue;
             }
+            const auto iw = (cSW * ow + kw) - zPW;
+            // the channels are the innermost dimension of both the image and the filter
+            const auto imageIndex = getQubeIndex(ih, iw, 0u, IW, IC);
+            const auto filterIndex = getQubeIndex(kh, kw, 0u, KW, KC);
+            output += sdot(KC, image + imageIndex, filter + filterIndex);
         }
     }
     output += bias;
@@ -255,21 +260,32 @@ void CNN2DFilter32(intel_dnn_component_t* component) {
     if (kc != IC) {
         THROW_GNA_EXCEPTION << "Depth of filter should be equal to input depth!" << layer_name;
     }
-    auto kernelIndex = 0;
-    for (unsigned oc = 0; oc < OC; oc++) {
-        for (unsigned ow = 0; ow < OW; ow++) {
-            for (unsigned oh = 0; oh < OH; oh++) {
-                const auto outputIndex = getQubeIndex(oh, ow, oc, OW, OC);
-                ptr_outputs[outputIndex] = CNN2DFilter32SingleHWC(*(ptr_biases + oc), ptr_filters + kernelIndex, kh, kw, kc,
-                    ptr_inputs, IH, IW, IC,
-                    oh, ow, oc,
-                    component->op.conv2D.convStride,
-                    component->op.conv2D.zeroPadding);
+    // the padding is validated once for the farthest output, so the filter threads never throw
+    if (OH > 0 && OW > 0 && kh > 0 && kw > 0) {
+        matchesPaddedArea(kh - 1, OH - 1, IH, component->op.conv2D.zeroPadding[0], component->op.conv2D.convStride[0]);
+        matchesPaddedArea(kw - 1, OW - 1, IW, component->op.conv2D.zeroPadding[1], component->op.conv2D.convStride[1]);
+    }
+
+    // kernel padded to 16B = 4 * sizeof(float)
+    const auto kernelStride = ALIGN(kh * kw * kc, GNAPluginNS::GNALimitations::convEachKernelByteAlignment / sizeof(float));
+    const auto nthr = GNAPluginNS::runtime::GetWorkThreads(static_cast<size_t>(OC) * OH * OW * kh * kw * kc);
+    InferenceEngine::parallel_nt(nthr, [&](const int ithr, const int nthr) {
+        uint32_t start = 0, end = 0;
+        InferenceEngine::splitter(OC, static_cast<uint32_t>(nthr), static_cast<uint32_t>(ithr), start, end);
+        for (unsigned oc = start; oc < end; oc++) {
+            const auto kernelIndex = oc * kernelStride;
+            for (unsigned ow = 0; ow < OW; ow++) {
+                for (unsigned oh = 0; oh < OH; oh++) {
+                    const auto outputIndex = getQubeIndex(oh, ow, oc, OW, OC);
+                    ptr_outputs[outputIndex] = CNN2DFilter32SingleHWC(*(ptr_biases + oc), ptr_filters + kernelIndex, kh, kw, kc,
+                        ptr_inputs, IH, IW, IC,
+                        oh, ow, oc,
+                        component->op.conv2D.convStride,
+                        component->op.conv2D.zeroPadding);
+                }
             }
         }
-        // kernel padded to 16B = 4 * sizeof(float)
-        kernelIndex += ALIGN(kh * kw * kc, GNAPluginNS::GNALimitations::convEachKernelByteAlignment / sizeof(float));
-    }
+    });
 }
 
 namespace {
@@ -1,14 +1,74 @@
 // Copyright (C) 2018-2022 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
-// floatmath.cpp : unoptimized floating point math routines (for reference)
+// floatmath.cpp : floating point math routines for the software emulation, the loops are blocked
+// to be auto-vectorized by the compiler and the large matrices are split between the threads
 //
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdio>
 
+#include <ie_parallel.hpp>
+
 #include "floatmath.h"
 
+namespace {
+
+// the smallest number of multiply-adds (or elements) worth to be processed by a separate thread
+constexpr size_t kMinWorkPerThread = 16384;
+
+// independent partial sums let the compiler vectorize the reduction without reordering it itself
+inline float dot(size_t n, const float *x, const float *y) {
+    constexpr size_t kBlock = 8;
+    float partial[kBlock] = {};
+    size_t k = 0;
+    for (; k + kBlock <= n; k += kBlock) {
+        for (size_t b = 0; b < kBlock; b++) {
+            partial[b] += x[k + b] * y[k + b];
+        }
+    }
+    float sum = 0.0f;
+    for (size_t b = 0; b < kBlock; b++) {
+        sum += partial[b];
+    }
+    for (; k < n; k++) {
+        sum += x[k] * y[k];
+    }
+    return sum;
+}
+
+// c[0..n) += a * b[0..n)
+inline void axpy(size_t n, float a, const float *b, float *c) {
+    for (size_t j = 0; j < n; j++) {
+        c[j] += a * b[j];
+    }
+}
+
+// Calls func(start, end) for the parts of [0, rows) on the threads, the amount of threads depends on the total work
+template <typename F>
+void for_rows(size_t rows, size_t work_per_row, const F &func) {
+    const int nthr = GNAPluginNS::runtime::GetWorkThreads(rows * work_per_row);
+    InferenceEngine::parallel_nt(std::min<int>(nthr, static_cast<int>(std::max<size_t>(rows, 1))),
+                                 [&](const int ithr, const int nthr) {
+                                     size_t start = 0, end = 0;
+                                     InferenceEngine::splitter(rows, nthr, ithr, start, end);
+                                     if (start < end)
+                                         func(start, end);
+                                 });
+}
+
+}  // namespace
+
+namespace GNAPluginNS {
+namespace runtime {
+int GetWorkThreads(size_t work_amount) {
+    const size_t nthr = static_cast<size_t>(std::max(InferenceEngine::parallel_get_work_threads(), 1));
+    return static_cast<int>(std::max<size_t>(std::min(nthr, work_amount / kMinWorkPerThread), 1));
+}
+}  // namespace runtime
+}  // namespace GNAPluginNS
+
 #ifdef __cplusplus
 extern "C" {  // API uses C linkage so that it can be used by C and C++ applications
 #endif
@@ -19,44 +79,46 @@ void cblas_sgemm1(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
                   const MKL_INT K, const float alpha, const float *A,
                   const MKL_INT lda, const float *B, const MKL_INT ldb,
                   const float beta, float *C, const MKL_INT ldc) {
-    int i, j, k;
-
     if (Layout != CblasRowMajor) {
         fprintf(stderr, "Only row major is supported in cblas_sgemm!\n");
         throw -1;
     }
 
+    const size_t work_per_row = static_cast<size_t>(N) * K;
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
+        for_rows(M, work_per_row, [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; i++) {
+                float *c = C + i * ldc;
+                if (N == 1 && ldb == 1) {
+                    c[0] = ((beta == 1.0) ? c[0] : 0) + dot(K, A + i * lda, B);
+                    continue;
+                }
+                if (beta != 1.0)
+                    std::fill(c, c + N, 0.0f);
+                for (MKL_INT k = 0; k < K; k++) {
+                    axpy(N, A[i * lda + k], B + k * ldb, c);
                 }
-                C[i * ldc + j] = sum;
             }
-        }
+        });
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum;
-                sum = beta * C[i * ldc + j];
-                for (k = 0; k < K; k++) {
-                    sum += alpha * A[i * lda + k] * B[j * ldb + k];
+        for_rows(M, work_per_row, [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; i++) {
+                for (MKL_INT j = 0; j < N; j++) {
+                    C[i * ldc + j] = beta * C[i * ldc + j] + alpha * dot(K, A + i * lda, B + j * ldb);
                 }
-                C[i * ldc + j] = sum;
             }
-        }
+        });
     } else if ((TransA == CblasTrans) && (TransB == CblasNoTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[k * lda + i] * B[k * ldb + j];
+        for_rows(M, work_per_row, [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; i++) {
+                float *c = C + i * ldc;
+                if (beta != 1.0)
+                    std::fill(c, c + N, 0.0f);
+                for (MKL_INT k = 0; k < K; k++) {
+                    axpy(N, A[k * lda + i], B + k * ldb, c);
                 }
-                C[i * ldc + j] = sum;
             }
-        }
+        });
     } else {
         fprintf(stderr, "Expected A not transposed in cblas_sgemm!\n");
         throw -1;
@@ -97,47 +159,45 @@ void cblas_sgemm_subset(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
                         const MKL_INT lda, const float *B, const MKL_INT ldb,
                         const float beta, float *C, const MKL_INT ldc,
                         const uint32_t *OutputList, const MKL_INT L) {
-    int i, j, k, l;
-
     if (Layout != CblasRowMajor) {
         fprintf(stderr, "Only row major is supported in cblas_sgemm_subset!\n");
         throw -1;
     }
 
+    const size_t work_per_row = static_cast<size_t>(N) * K;
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (l = 0; l < L; l++) {
-            i = OutputList[l];
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
+        for_rows(L, work_per_row, [&](size_t start, size_t end) {
+            for (size_t l = start; l < end; l++) {
+                const size_t i = OutputList[l];
+                float *c = C + l * ldc;
+                if (beta != 1.0)
+                    std::fill(c, c + N, 0.0f);
+                for (MKL_INT k = 0; k < K; k++) {
+                    axpy(N, A[i * lda + k], B + k * ldb, c);
                 }
-                C[l * ldc + j] = sum;
             }
-        }
+        });
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
-        for (i = 0; i < M; i++) {
-            for (l = 0; l < L; l++) {
-                float sum;
-                j = OutputList[l];
-                sum = beta * C[i * ldc + l];
-                for (k = 0; k < K; k++) {
-                    sum += alpha * A[i * lda + k] * B[j * ldb + k];
+        for_rows(M, static_cast<size_t>(L) * K, [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; i++) {
+                for (MKL_INT l = 0; l < L; l++) {
+                    const size_t j = OutputList[l];
+                    C[i * ldc + l] = beta * C[i * ldc + l] + alpha * dot(K, A + i * lda, B + j * ldb);
                 }
-                C[i * ldc + l] = sum;
             }
-        }
+        });
     } else if ((TransA == CblasTrans) && (TransB == CblasNoTrans)) {
-        for (l = 0; l < L; l++) {
-            i = OutputList[l];
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[k * lda + i] * B[k * ldb + j];
+        for_rows(L, work_per_row, [&](size_t start, size_t end) {
+            for (size_t l = start; l < end; l++) {
+                const size_t i = OutputList[l];
+                float *c = C + l * ldc;
+                if (beta != 1.0)
+                    std::fill(c, c + N, 0.0f);
+                for (MKL_INT k = 0; k < K; k++) {
+                    axpy(N, A[k * lda + i], B + k * ldb, c);
                 }
-                C[l * ldc + j] = sum;
             }
-        }
+        });
     } else {
         fprintf(stderr, "Expected A not transposed in cblas_sgemm_subset!\n");
         throw -1;
@@ -153,20 +213,17 @@ void sgemv_split(const uint32_t N,
                  const float *X,
                  const float *B,
                  float *C) {
-    uint32_t num_columns = K1 + K2;
-    uint32_t num_rows = N;
-    uint32_t i, j;
-
-    for (i = 0; i < num_rows; i++) {
-        float sum = B[i];
-        for (j = 0; j < K1; j++) {
-            sum += A1[j] * X[i * num_columns + j];
-        }
-        for (j = K1; j < num_columns; j++) {
-            sum += A2[j - K1] * X[i * num_columns + j];
+    const size_t num_columns = K1 + K2;
+    for_rows(N, num_columns, [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; i++) {
+            const float *x = X + i * num_columns;
+            C[i] = B[i] + dot(K1, A1, x) + dot(K2, A2, x + K1);
         }
-        C[i] = sum;
-    }
+    });
+}
+
+float sdot(const uint32_t N, const float *X, const float *Y) {
+    return dot(N, X, Y);
 }
 
 #ifdef __cplusplus
@@ -58,7 +58,18 @@ void sgemv_split(const uint32_t N,
                  const float *X,
                  const float *B,
                  float *C);
+float sdot(const uint32_t N, const float *X, const float *Y);
 
 #ifdef __cplusplus
 }
+
+namespace GNAPluginNS {
+namespace runtime {
+/**
+ * @brief Returns the number of threads to process the given amount of work (multiply-adds or elements),
+ * the small components are processed by the calling thread only
+ */
+int GetWorkThreads(size_t work_amount);
+}  // namespace runtime
+}  // namespace GNAPluginNS
 #endif
@@ -25,7 +25,10 @@
 #define TANH(num, in, out) vsTanh(num, in, out)
 #endif
 
+#include <ie_parallel.hpp>
+
 #include "pwl.h"
+#include "floatmath.h"
 #include "log/debug.hpp"
 #include "log/log.hpp"
 #include "gna_slope_scale.h"
@@ -398,6 +401,48 @@ void PwlApply32(intel_dnn_component_t *component, uint32_t num_subset_size) {
     }
 }
 
+namespace {
+
+struct PwlArea {
+    const float *ptr_in;
+    float *ptr_out;
+    uint32_t num_columns;
+    uint32_t num_row_start;
+    uint32_t num_row_end;
+    uint32_t num_col_start;
+    uint32_t num_col_end;
+};
+
+// Applies out = func(in, row) to the [num_row_start, num_row_end] x [num_col_start, num_col_end] area.
+// The elements are split between the threads evenly, each thread processes the contiguous column runs,
+// so the simple functions are vectorized by the compiler.
+template <typename F>
+void ApplyElementwise(const PwlArea &area, const F &func) {
+    if (area.num_row_end < area.num_row_start || area.num_col_end < area.num_col_start) {
+        return;
+    }
+    const size_t row_size = area.num_col_end - area.num_col_start + 1;
+    const size_t work_amount = static_cast<size_t>(area.num_row_end - area.num_row_start + 1) * row_size;
+    const auto nthr = GNAPluginNS::runtime::GetWorkThreads(work_amount);
+    InferenceEngine::parallel_nt(nthr, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        InferenceEngine::splitter(work_amount, nthr, ithr, start, end);
+        while (start < end) {
+            const auto i = static_cast<uint32_t>(area.num_row_start + start / row_size);
+            const auto j_start = start % row_size;
+            const auto j_end = (std::min)(row_size, j_start + (end - start));
+            const float *in = area.ptr_in + static_cast<size_t>(i) * area.num_columns + area.num_col_start;
+            float *out = area.ptr_out + static_cast<size_t>(i) * area.num_columns + area.num_col_start;
+            for (size_t j = j_start; j < j_end; j++) {
+                out[j] = func(in[j], i);
+            }
+            start += j_end - j_start;
+        }
+    });
+}
+
+}  // namespace
+
 void PwlApply32(intel_dnn_component_t *component,
                 uint32_t num_row_start,
                 uint32_t num_row_end,
@@ -407,133 +452,102 @@ void PwlApply32(intel_dnn_component_t *component,
     float *ptr_in = reinterpret_cast<float *>(component->ptr_inputs);
     float *ptr_out = reinterpret_cast<float *>(component->ptr_outputs);
     uint32_t num_columns = component->num_columns_in;
+    const PwlArea area{ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end};
     switch (transform->func_id.type) {
         case kActSigmoid:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = 0.5f * (1.0f + tanh(0.5f * ptr_in[i * num_columns + j]));
-                }
-            }
+            ApplyElementwise(area, [](float x, uint32_t) {
+                return 0.5f * (1.0f + tanh(0.5f * x));
+            });
             break;
         case kActTanh:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = tanh(ptr_in[i * num_columns + j]);
-                }
-            }
+            ApplyElementwise(area, [](float x, uint32_t) {
+                return tanh(x);
+            });
             break;
         case kActSoftSign:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = static_cast<float>(ptr_in[i * num_columns + j] / (1.0 + fabs(ptr_in[i * num_columns + j])));
-                }
-            }
+            ApplyElementwise(area, [](float x, uint32_t) {
+                return static_cast<float>(x / (1.0 + fabs(x)));
+            });
             break;
-        case kActRelu:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] =
-                        (ptr_in[i * num_columns + j] < 0.0f) ?
-                            ptr_in[i * num_columns + j] * transform->func_id.args.lrelu.negative_slope :
-                            ptr_in[i * num_columns + j];
-                }
-            }
+        case kActRelu: {
+            const float negative_slope = transform->func_id.args.lrelu.negative_slope;
+            ApplyElementwise(area, [negative_slope](float x, uint32_t) {
+                return (x < 0.0f) ? x * negative_slope : x;
+            });
             break;
+        }
         case kActIdentity:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = ptr_in[i * num_columns + j];
-                }
-            }
+            ApplyElementwise(area, [](float x, uint32_t) {
+                return x;
+            });
             break;
         case kActKaldiLstmClipping: {
             float upper_limit = component->op.pwl.func_id.args.clamp.high;
             float lower_limit = component->op.pwl.func_id.args.clamp.low;
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    float val = ptr_in[i * num_columns + j];
-                    if (val > upper_limit) {
-                        ptr_out[i * num_columns + j] = upper_limit;
-                    } else if (val < lower_limit) {
-                        ptr_out[i * num_columns + j] = lower_limit;
-                    } else {
-                        ptr_out[i * num_columns + j] = val;
-                    }
+            ApplyElementwise(area, [upper_limit, lower_limit](float val, uint32_t) {
+                if (val > upper_limit) {
+                    return upper_limit;
+                } else if (val < lower_limit) {
+                    return lower_limit;
                 }
-            }
+                return val;
+            });
             break;
         }
         case kActExp:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = exp(ptr_in[i * num_columns + j]);
-                }
-            }
+            ApplyElementwise(area, [](float x, uint32_t) {
+                return exp(x);
+            });
             break;
         case kActLog:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = std::log(ptr_in[i * num_columns + j]);
-                }
-            }
+            ApplyElementwise(area, [](float x, uint32_t) {
+                return std::log(x);
+            });
             break;
         case kActAbs:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = fabs(ptr_in[i * num_columns + j]);
-                }
-            }
+            ApplyElementwise(area, [](float x, uint32_t) {
+                return fabs(x);
+            });
             break;
         case kActSign:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = (ptr_in[i * num_columns + j] == 0.f) ? 0.0f : ((ptr_in[i * num_columns + j] > 0) ? 1.0f : -1.0f);
-                }
-            }
+            ApplyElementwise(area, [](float x, uint32_t) {
+                return (x == 0.f) ? 0.0f : ((x > 0) ? 1.0f : -1.0f);
+            });
             break;
         case kActNegLog:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = static_cast<float>(-1.0 * std::log(ptr_in[i * num_columns + j]));
-                }
-            }
+            ApplyElementwise(area, [](float x, uint32_t) {
+                return static_cast<float>(-1.0 * std::log(x));
+            });
             break;
         case kActNegHalfLog:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = static_cast<float>(-0.5 * std::log(ptr_in[i * num_columns + j]));
-                }
-            }
+            ApplyElementwise(area, [](float x, uint32_t) {
+                return static_cast<float>(-0.5 * std::log(x));
+            });
             break;
         case kActPow: {
                 float exponent = transform->func_id.args.pow.exponent;
                 float scale = transform->func_id.args.pow.scale;
                 float offset = transform->func_id.args.pow.offset;
-                for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                    for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                        ptr_out[i * num_columns + j] = static_cast<float>(pow(offset + scale * ptr_in[i * num_columns + j], exponent));
-                    }
-                }
+                ApplyElementwise(area, [exponent, scale, offset](float x, uint32_t) {
+                    return static_cast<float>(pow(offset + scale * x, exponent));
+                });
             }
             break;
         case kActFakeQuantize: {
             double levels = static_cast<double>(transform->func_id.fqParams.levels);
+            const auto &fqParams = transform->func_id.fqParams;
 
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                auto inputChannel  = transform->func_id.fqParams.inputPerChannel ? i : 0;
-                auto outputChannel = transform->func_id.fqParams.outputPerChannel ? i : 0;
-
-                double input_low   = transform->func_id.fqParams.input_low[inputChannel];
-                double input_high  = transform->func_id.fqParams.input_high[inputChannel];
-                double output_low  = transform->func_id.fqParams.output_low[outputChannel];
-                double output_high = transform->func_id.fqParams.output_high[outputChannel];
+            ApplyElementwise(area, [&fqParams, levels](float x, uint32_t i) {
+                auto inputChannel  = fqParams.inputPerChannel ? i : 0;
+                auto outputChannel = fqParams.outputPerChannel ? i : 0;
 
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    auto offset = i * num_columns + j;
+                double input_low   = fqParams.input_low[inputChannel];
+                double input_high  = fqParams.input_high[inputChannel];
+                double output_low  = fqParams.output_low[outputChannel];
+                double output_high = fqParams.output_high[outputChannel];
 
-                    ptr_out[offset] = ov::intel_gna::frontend::ApplyFQ(ptr_in[offset], input_low, input_high, output_low, output_high, levels);
-                }
-            }
+                return ov::intel_gna::frontend::ApplyFQ(x, input_low, input_high, output_low, output_high, levels);
+            });
             break;
         }
         case kActCustom:
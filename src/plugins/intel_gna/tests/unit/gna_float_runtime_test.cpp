@@ -0,0 +1,420 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_parallel.hpp>
+
+#include "backend/dnn_types.h"
+#include "frontend/quantization.hpp"
+#include "runtime/cnn.h"
+#include "runtime/floatmath.h"
+#include "runtime/pwl.h"
+
+namespace {
+
+// Runs the function on several threads even on a small machine, so the work of the large components is split
+template <typename F>
+void runOnThreads(const F& func) {
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+    tbb::task_arena arena(4);
+    arena.execute(func);
+#else
+    func();
+#endif
+}
+
+std::vector<float> transposed(const std::vector<float>& matrix, int rows, int columns) {
+    std::vector<float> result(matrix.size());
+    for (int i = 0; i < rows; i++) {
+        for (int j = 0; j < columns; j++) {
+            result[j * rows + i] = matrix[i * columns + j];
+        }
+    }
+    return result;
+}
+
+// The scalar reference of the runtime GEMM: alpha and beta are applied only with the transposed B, otherwise
+// C is accumulated when beta is 1 and overwritten for other values. If the output list is given, it selects
+// the rows of A (or the rows of the transposed B) to compute.
+std::vector<float> referenceGemm(CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, int M, int N, int K, float alpha,
+                                 const std::vector<float>& A, int lda, const std::vector<float>& B, int ldb,
+                                 float beta, std::vector<float> C, int ldc,
+                                 const std::vector<uint32_t>* outputList = nullptr) {
+    const bool subsetColumns = outputList && transB == CblasTrans;
+    const bool subsetRows = outputList && !subsetColumns;
+    const int rows = subsetRows ? static_cast<int>(outputList->size()) : M;
+    const int columns = subsetColumns ? static_cast<int>(outputList->size()) : N;
+    for (int r = 0; r < rows; r++) {
+        const int i = subsetRows ? (*outputList)[r] : r;
+        for (int c = 0; c < columns; c++) {
+            const int j = subsetColumns ? (*outputList)[c] : c;
+            float sum = 0.0f;
+            for (int k = 0; k < K; k++) {
+                const float a = transA == CblasTrans ? A[k * lda + i] : A[i * lda + k];
+                const float b = transB == CblasTrans ? B[j * ldb + k] : B[k * ldb + j];
+                sum += a * b;
+            }
+            auto& out = C[r * ldc + c];
+            out = transB == CblasTrans ? beta * out + alpha * sum : ((beta == 1.0f) ? out : 0.0f) + sum;
+        }
+    }
+    return C;
+}
+
+class GnaFloatMathTest : public ::testing::TestWithParam<std::tuple<int, int, int>> {
+protected:
+    void SetUp() override {
+        std::tie(M, N, K) = GetParam();
+        A.resize(M * K);
+        B.resize(K * N);
+        for (size_t i = 0; i < A.size(); i++) {
+            A[i] = std::sin(0.3f * i);
+        }
+        for (size_t i = 0; i < B.size(); i++) {
+            B[i] = std::cos(0.7f * i);
+        }
+    }
+
+    // C = C + A * B, A is M x K, B is K x N
+    std::vector<float> reference(const std::vector<float>& C) const {
+        auto result = C;
+        for (int i = 0; i < M; i++) {
+            for (int j = 0; j < N; j++) {
+                for (int k = 0; k < K; k++) {
+                    result[i * N + j] += A[i * K + k] * B[k * N + j];
+                }
+            }
+        }
+        return result;
+    }
+
+    void expectNear(const std::vector<float>& expected, const std::vector<float>& actual) const {
+        ASSERT_EQ(expected.size(), actual.size());
+        for (size_t i = 0; i < expected.size(); i++) {
+            EXPECT_NEAR(expected[i], actual[i], 1e-4f * K) << "at " << i;
+        }
+    }
+
+    int M = 0, N = 0, K = 0;
+    std::vector<float> A, B;
+};
+
+TEST_P(GnaFloatMathTest, sgemmMatchesReference) {
+    std::vector<float> C(M * N, 1.0f);
+    const auto expected = reference(C);
+
+    auto actual = C;
+    cblas_sgemm1(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0f, A.data(), K, B.data(), N, 1.0f, actual.data(), N);
+    expectNear(expected, actual);
+
+    std::vector<float> Bt(N * K);
+    for (int k = 0; k < K; k++) {
+        for (int j = 0; j < N; j++) {
+            Bt[j * K + k] = B[k * N + j];
+        }
+    }
+    actual = C;
+    cblas_sgemm1(CblasRowMajor, CblasNoTrans, CblasTrans, M, N, K, 1.0f, A.data(), K, Bt.data(), K, 1.0f, actual.data(), N);
+    expectNear(expected, actual);
+
+    std::vector<float> At(K * M);
+    for (int i = 0; i < M; i++) {
+        for (int k = 0; k < K; k++) {
+            At[k * M + i] = A[i * K + k];
+        }
+    }
+    actual = C;
+    cblas_sgemm1(CblasRowMajor, CblasTrans, CblasNoTrans, M, N, K, 1.0f, At.data(), M, B.data(), N, 1.0f, actual.data(), N);
+    expectNear(expected, actual);
+}
+
+TEST_P(GnaFloatMathTest, sgemvSplitMatchesReference) {
+    const uint32_t K1 = K / 3;
+    const uint32_t K2 = K - K1;
+    // X is M x K, the weights are split into the K1 and K2 parts
+    const std::vector<float> bias(M, 0.5f);
+    std::vector<float> weights(K);
+    for (int k = 0; k < K; k++) {
+        weights[k] = std::cos(0.1f * k);
+    }
+    std::vector<float> expected(M);
+    for (int i = 0; i < M; i++) {
+        expected[i] = bias[i];
+        for (int k = 0; k < K; k++) {
+            expected[i] += weights[k] * A[i * K + k];
+        }
+    }
+
+    std::vector<float> actual(M);
+    sgemv_split(M, K1, K2, weights.data(), weights.data() + K1, A.data(), bias.data(), actual.data());
+    expectNear(expected, actual);
+}
+
+TEST_P(GnaFloatMathTest, sgemmBetaMatchesReference) {
+    const auto At = transposed(A, M, K);
+    const auto Bt = transposed(B, K, N);
+    std::vector<float> C(M * N);
+    for (size_t i = 0; i < C.size(); i++) {
+        C[i] = std::sin(0.5f * i);
+    }
+    const float alpha = 2.0f;
+    for (const float beta : {0.0f, 0.5f}) {
+        auto actual = C;
+        runOnThreads([&] {
+            cblas_sgemm1(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, alpha, A.data(), K, B.data(), N, beta, actual.data(), N);
+        });
+        expectNear(referenceGemm(CblasNoTrans, CblasNoTrans, M, N, K, alpha, A, K, B, N, beta, C, N), actual);
+
+        actual = C;
+        runOnThreads([&] {
+            cblas_sgemm1(CblasRowMajor, CblasNoTrans, CblasTrans, M, N, K, alpha, A.data(), K, Bt.data(), K, beta, actual.data(), N);
+        });
+        expectNear(referenceGemm(CblasNoTrans, CblasTrans, M, N, K, alpha, A, K, Bt, K, beta, C, N), actual);
+
+        actual = C;
+        runOnThreads([&] {
+            cblas_sgemm1(CblasRowMajor, CblasTrans, CblasNoTrans, M, N, K, alpha, At.data(), M, B.data(), N, beta, actual.data(), N);
+        });
+        expectNear(referenceGemm(CblasTrans, CblasNoTrans, M, N, K, alpha, At, M, B, N, beta, C, N), actual);
+    }
+}
+
+TEST_P(GnaFloatMathTest, sgemmSubsetMatchesReference) {
+    const auto At = transposed(A, M, K);
+    const auto Bt = transposed(B, K, N);
+    // every second row of A in the reverse order
+    std::vector<uint32_t> rows;
+    for (int i = M - 1; i >= 0; i -= 2) {
+        rows.push_back(static_cast<uint32_t>(i));
+    }
+    // every second row of the transposed B in the reverse order
+    std::vector<uint32_t> columns;
+    for (int j = N - 1; j >= 0; j -= 2) {
+        columns.push_back(static_cast<uint32_t>(j));
+    }
+    const int L = static_cast<int>(rows.size());
+    const int LB = static_cast<int>(columns.size());
+    const float alpha = 1.0f;
+    for (const float beta : {1.0f, 0.0f}) {
+        std::vector<float> C(L * N, 1.0f);
+        auto actual = C;
+        runOnThreads([&] {
+            cblas_sgemm_subset(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, alpha, A.data(), K, B.data(), N, beta,
+                               actual.data(), N, rows.data(), L);
+        });
+        expectNear(referenceGemm(CblasNoTrans, CblasNoTrans, M, N, K, alpha, A, K, B, N, beta, C, N, &rows), actual);
+
+        actual = C;
+        runOnThreads([&] {
+            cblas_sgemm_subset(CblasRowMajor, CblasTrans, CblasNoTrans, M, N, K, alpha, At.data(), M, B.data(), N, beta,
+                               actual.data(), N, rows.data(), L);
+        });
+        expectNear(referenceGemm(CblasTrans, CblasNoTrans, M, N, K, alpha, At, M, B, N, beta, C, N, &rows), actual);
+
+        C.assign(M * LB, 1.0f);
+        actual = C;
+        runOnThreads([&] {
+            cblas_sgemm_subset(CblasRowMajor, CblasNoTrans, CblasTrans, M, N, K, alpha, A.data(), K, Bt.data(), K, beta,
+                               actual.data(), LB, columns.data(), LB);
+        });
+        expectNear(referenceGemm(CblasNoTrans, CblasTrans, M, N, K, alpha, A, K, Bt, K, beta, C, LB, &columns), actual);
+    }
+}
+
+// the large sizes are split between the threads
+INSTANTIATE_TEST_SUITE_P(GnaFloatMath, GnaFloatMathTest,
+                         ::testing::Values(std::make_tuple(1, 1, 1),
+                                           std::make_tuple(37, 1, 29),
+                                           std::make_tuple(37, 3, 29),
+                                           std::make_tuple(1024, 1, 513),
+                                           std::make_tuple(257, 8, 640)));
+
+TEST(GnaFloatCnnTest, CNNFilter32StrideMatchesReference) {
+    const uint32_t numFilters = 8, filterSize = 16, stride = 8;
+    const uint32_t numInputs = 8016;
+    const uint32_t numOutputsPerFilter = (numInputs - filterSize) / stride + 1;
+
+    std::vector<float> input(numInputs), filters(numFilters * filterSize), biases(numFilters);
+    for (size_t i = 0; i < input.size(); i++) {
+        input[i] = std::sin(0.1f * i);
+    }
+    for (size_t i = 0; i < filters.size(); i++) {
+        filters[i] = std::cos(0.3f * i);
+    }
+    for (size_t i = 0; i < biases.size(); i++) {
+        biases[i] = 0.25f * i;
+    }
+    std::vector<float> output(numOutputsPerFilter * numFilters);
+
+    intel_dnn_component_t component{};
+    component.num_rows_in = 1;
+    component.num_rows_out = 1;
+    component.num_columns_in = numInputs;
+    component.num_columns_out = static_cast<uint32_t>(output.size());
+    component.op.conv1D.num_filters = numFilters;
+    component.op.conv1D.num_filter_coefficients = filterSize;
+    component.op.conv1D.convStride = stride;
+    component.op.conv1D.ptr_filters = filters.data();
+    component.op.conv1D.ptr_biases = biases.data();
+    component.ptr_inputs = input.data();
+    component.ptr_outputs = output.data();
+    component.original_layer_name = "conv1d";
+    runOnThreads([&] {
+        CNNFilter32(&component);
+    });
+
+    for (uint32_t j = 0; j < numOutputsPerFilter; j++) {
+        for (uint32_t i = 0; i < numFilters; i++) {
+            float expected = biases[i];
+            for (uint32_t k = 0; k < filterSize; k++) {
+                expected += input[j * stride + k] * filters[i * filterSize + k];
+            }
+            ASSERT_NEAR(expected, output[j * numFilters + i], 1e-4f * filterSize) << "output " << j << ", filter " << i;
+        }
+    }
+}
+
+TEST(GnaFloatCnnTest, CNN2DFilter32PaddingAndStrideMatchesReference) {
+    const uint32_t IH = 9, IW = 11, IC = 3;
+    const uint32_t OC = 128, KH = 3, KW = 3;
+    const uint32_t strideH = 2, strideW = 3, padH = 1, padW = 2;
+    const uint32_t OH = (IH + 2 * padH - KH) / strideH + 1;
+    const uint32_t OW = (IW + 2 * padW - KW) / strideW + 1;
+    // every kernel is padded to 16 bytes
+    const uint32_t kernelStride = (KH * KW * IC + 3) / 4 * 4;
+
+    std::vector<float> input(IH * IW * IC), filters(OC * kernelStride, 0.0f), biases(OC);
+    for (size_t i = 0; i < input.size(); i++) {
+        input[i] = std::sin(0.2f * i);
+    }
+    for (uint32_t oc = 0; oc < OC; oc++) {
+        for (uint32_t k = 0; k < KH * KW * IC; k++) {
+            filters[oc * kernelStride + k] = std::cos(0.1f * (oc + k));
+        }
+        biases[oc] = 0.01f * oc;
+    }
+    std::vector<float> output(OH * OW * OC);
+
+    intel_dnn_component_t component{};
+    component.tensors = {{{1, IH, IW, IC}, OvGnaTypeInt32, OvGnaModeDefault},
+                         {{1, OH, OW, OC}, OvGnaTypeInt32, OvGnaModeDefault},
+                         {{OC, KH, KW, IC}, OvGnaTypeInt32, OvGnaModeDefault}};
+    component.op.conv2D.convStride = {strideH, strideW};
+    component.op.conv2D.zeroPadding = {padH, padW};
+    component.op.conv2D.ptr_filters = filters.data();
+    component.op.conv2D.ptr_biases = biases.data();
+    component.ptr_inputs = input.data();
+    component.ptr_outputs = output.data();
+    component.original_layer_name = "conv2d";
+    runOnThreads([&] {
+        CNN2DFilter32(&component);
+    });
+
+    for (uint32_t oh = 0; oh < OH; oh++) {
+        for (uint32_t ow = 0; ow < OW; ow++) {
+            for (uint32_t oc = 0; oc < OC; oc++) {
+                float expected = biases[oc];
+                for (uint32_t kh = 0; kh < KH; kh++) {
+                    for (uint32_t kw = 0; kw < KW; kw++) {
+                        const int ih = static_cast<int>(oh * strideH + kh) - static_cast<int>(padH);
+                        const int iw = static_cast<int>(ow * strideW + kw) - static_cast<int>(padW);
+                        if (ih < 0 || ih >= static_cast<int>(IH) || iw < 0 || iw >= static_cast<int>(IW))
+                            continue;
+                        for (uint32_t c = 0; c < IC; c++) {
+                            expected += input[(ih * IW + iw) * IC + c] * filters[oc * kernelStride + (kh * KW + kw) * IC + c];
+                        }
+                    }
+                }
+                ASSERT_NEAR(expected, output[(oh * OW + ow) * OC + oc], 1e-4f * KH * KW * IC)
+                    << "output " << oh << "x" << ow << ", channel " << oc;
+            }
+        }
+    }
+}
+
+class GnaFloatPwlTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        input.resize(kRows * kColumns);
+        for (size_t i = 0; i < input.size(); i++) {
+            input[i] = 4.0f * std::sin(0.01f * i);
+        }
+        output.assign(input.size(), kUntouched);
+        component.num_rows_in = kRows;
+        component.num_columns_in = kColumns;
+        component.ptr_inputs = input.data();
+        component.ptr_outputs = output.data();
+        component.original_layer_name = "pwl";
+    }
+
+    // The area is not aligned to the rows and is not evenly split between the threads,
+    // so the thread parts start and end in the middle of the rows
+    template <typename F>
+    void applyAndCheck(const F& reference) {
+        runOnThreads([&] {
+            PwlApply32(&component, kRowStart, kRowEnd, kColStart, kColEnd);
+        });
+        for (uint32_t i = 0; i < kRows; i++) {
+            for (uint32_t j = 0; j < kColumns; j++) {
+                const auto index = i * kColumns + j;
+                const bool inArea = i >= kRowStart && i <= kRowEnd && j >= kColStart && j <= kColEnd;
+                const float expected = inArea ? reference(input[index], i) : kUntouched;
+                ASSERT_FLOAT_EQ(expected, output[index]) << "at " << i << "x" << j;
+            }
+        }
+    }
+
+    static constexpr uint32_t kRows = 41, kColumns = 4103;
+    static constexpr uint32_t kRowStart = 1, kRowEnd = 39, kColStart = 3, kColEnd = 4100;
+    static constexpr float kUntouched = -100.0f;
+    std::vector<float> input, output;
+    intel_dnn_component_t component{};
+};
+
+constexpr uint32_t GnaFloatPwlTest::kRows;
+constexpr uint32_t GnaFloatPwlTest::kColumns;
+constexpr uint32_t GnaFloatPwlTest::kRowStart;
+constexpr uint32_t GnaFloatPwlTest::kRowEnd;
+constexpr uint32_t GnaFloatPwlTest::kColStart;
+constexpr uint32_t GnaFloatPwlTest::kColEnd;
+constexpr float GnaFloatPwlTest::kUntouched;
+
+TEST_F(GnaFloatPwlTest, leakyReluUnevenSplitMatchesReference) {
+    component.op.pwl.func_id = DnnActivation::fromType(kActRelu);
+    component.op.pwl.func_id.args.lrelu.negative_slope = 0.1f;
+    applyAndCheck([](float x, uint32_t) {
+        return x < 0.0f ? x * 0.1f : x;
+    });
+}
+
+TEST_F(GnaFloatPwlTest, fakeQuantizePerChannelMatchesReference) {
+    // the rows are the channels
+    std::vector<float> inputLow(kRows), inputHigh(kRows), outputLow(kRows), outputHigh(kRows);
+    for (uint32_t i = 0; i < kRows; i++) {
+        inputLow[i] = -1.0f - 0.05f * i;
+        inputHigh[i] = 1.0f + 0.07f * i;
+        outputLow[i] = -2.0f + 0.01f * i;
+        outputHigh[i] = 2.0f - 0.02f * i;
+    }
+    const uint32_t levels = 256;
+    component.op.pwl.func_id = DnnActivation::fromType(kActFakeQuantize);
+    auto& fqParams = component.op.pwl.func_id.fqParams;
+    fqParams.set = 1;
+    fqParams.levels = levels;
+    fqParams.inputPerChannel = 1;
+    fqParams.input_low = inputLow.data();
+    fqParams.input_high = inputHigh.data();
+    fqParams.outputPerChannel = 1;
+    fqParams.output_low = outputLow.data();
+    fqParams.output_high = outputHigh.data();
+    applyAndCheck([&](float x, uint32_t i) {
+        return ov::intel_gna::frontend::ApplyFQ(x, inputLow[i], inputHigh[i], outputLow[i], outputHigh[i], levels);
+    });
+}
+
+}  // namespace
@@ -6,6 +6,7 @@
 
 #include <future>
 #include "base/ov_behavior_test_utils.hpp"
+#include "openvino/runtime/completion_queue.hpp"
 #include "shared_test_classes/subgraph/basic_lstm.hpp"
 
 namespace ov {
@@ -125,6 +126,63 @@ TEST_P(OVInferRequestCallbackTests, ImplDoesNotCopyCallback) {
     OV_ASSERT_NO_THROW(req.wait());
 }
 
+TEST_P(OVInferRequestCallbackTests, canPollSeveralRequestsWithCompletionQueue) {
+    const size_t num_requests = 4;
+    const size_t num_iter = 5;
+    ov::CompletionQueue queue;
+    std::vector<ov::InferRequest> reqs(num_requests);
+    for (size_t i = 0; i < num_requests; ++i) {
+        OV_ASSERT_NO_THROW(reqs[i] = execNet.create_infer_request());
+        OV_ASSERT_NO_THROW(queue.bind(reqs[i], i));
+        OV_ASSERT_NO_THROW(reqs[i].start_async());
+    }
+    std::vector<size_t> completed(num_requests, 0);
+    for (size_t done = 0; done < num_requests * num_iter; ++done) {
+        ov::CompletionQueue::Completion completion;
+        OV_ASSERT_NO_THROW(completion = queue.wait_any());
+        ASSERT_EQ(nullptr, completion.exception);
+        ASSERT_LT(completion.tag, num_requests);
+        OV_ASSERT_NO_THROW(reqs[completion.tag].wait());
+        if (++completed[completion.tag] < num_iter) {
+            OV_ASSERT_NO_THROW(reqs[completion.tag].start_async());
+        }
+    }
+    for (auto&& count : completed) {
+        ASSERT_EQ(num_iter, count);
+    }
+    ov::CompletionQueue::Completion completion;
+    ASSERT_FALSE(queue.try_pop(completion));
+}
+
+TEST_P(OVInferRequestCallbackTests, canResubmitRequestsFromCompletionQueueLoop) {
+    const size_t num_requests = 4;
+    const size_t num_iter = 500;
+    ov::CompletionQueue queue;
+    std::vector<ov::InferRequest> reqs(num_requests);
+    for (size_t i = 0; i < num_requests; ++i) {
+        OV_ASSERT_NO_THROW(reqs[i] = execNet.create_infer_request());
+        OV_ASSERT_NO_THROW(queue.bind(reqs[i], i));
+        OV_ASSERT_NO_THROW(reqs[i].start_async());
+    }
+    std::vector<size_t> completed(num_requests, 0);
+    for (size_t done = 0; done < num_requests * num_iter; ++done) {
+        // the request is started again without waiting, while its previous completion may still be delivered
+        ov::CompletionQueue::Completion completion;
+        ASSERT_TRUE(queue.wait_any_for(completion, std::chrono::seconds(10))) << "Completion is lost";
+        ASSERT_EQ(nullptr, completion.exception);
+        ASSERT_LT(completion.tag, num_requests);
+        if (++completed[completion.tag] < num_iter) {
+            OV_ASSERT_NO_THROW(reqs[completion.tag].start_async());
+        }
+    }
+    for (auto&& req : reqs) {
+        OV_ASSERT_NO_THROW(req.wait());
+    }
+    for (auto&& count : completed) {
+        ASSERT_EQ(num_iter, count);
+    }
+}
+
 }  // namespace behavior
 }  // namespace test
 }  // namespace ov
\ No newline at end of file
@@ -968,6 +968,39 @@ TEST_P(OVClassNetworkTestP, LoadNetworkActualNoThrow) {
     OV_ASSERT_NO_THROW(ie.compile_model(actualNetwork, target_device));
 }
 
+TEST_P(OVClassNetworkTestP, LoadNetworkAsyncActualNoThrow) {
+    ov::Core ie = createCoreWithTemplate();
+    std::vector<std::future<ov::CompiledModel>> futures;
+    for (size_t i = 0; i < 3; i++) {
+        futures.emplace_back(ie.compile_model_async(actualNetwork, target_device));
+    }
+    for (auto& future : futures) {
+        ov::CompiledModel compiled_model;
+        OV_ASSERT_NO_THROW(compiled_model = future.get());
+        OV_ASSERT_NO_THROW(compiled_model.create_infer_request());
+    }
+}
+
+TEST_P(OVClassNetworkTestP, LoadNetworkAsyncCoreDestroyedDuringCompilation) {
+    std::vector<std::future<ov::CompiledModel>> futures;
+    {
+        ov::Core ie = createCoreWithTemplate();
+        for (size_t i = 0; i < 3; i++) {
+            futures.emplace_back(ie.compile_model_async(actualNetwork, target_device));
+        }
+        // HETERO gets the core from the compilation task
+        futures.emplace_back(ie.compile_model_async(actualNetwork,
+                                                    CommonTestUtils::DEVICE_HETERO + std::string(":") + target_device));
+    }
+    // the core destructor waits for the started compilations
+    for (auto& future : futures) {
+        ASSERT_EQ(std::future_status::ready, future.wait_for(std::chrono::seconds(0)));
+        ov::CompiledModel compiled_model;
+        OV_ASSERT_NO_THROW(compiled_model = future.get());
+        OV_ASSERT_NO_THROW(compiled_model.create_infer_request());
+    }
+}
+
 TEST_P(OVClassNetworkTestP, LoadNetworkMultiWithoutSettingDevicePrioritiesThrows) {
     ov::Core ie = createCoreWithTemplate();
     ie.compile_model(actualNetwork, CommonTestUtils::DEVICE_MULTI);
@@ -11,6 +11,7 @@
 #include "openvino/util/file_util.hpp"
 #include <random>
 #include "ie_algorithm.hpp"
+#include "hetero/hetero_plugin_config.hpp"
 
 namespace HeteroTests {
 
@@ -193,4 +194,49 @@ TEST_P(HeteroSyntheticTest, someLayersToMajorPluginOthersToFallback) {
     }
 }
 
+TEST_P(HeteroSyntheticTest, queryNetworkAffinitiesWithMinimizedTransfers) {
+    // the functions are shared between the tests, so remove affinities set by other tests
+    for (auto&& node : function->get_ordered_ops()) {
+        node->get_rt_info().erase("affinity");
+    }
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    // total size of the tensors passed from a layer to the other devices executing its consumers
+    auto TransfersSize = [&](const std::map<std::string, std::string>& affinities) {
+        auto IsLayer = [](const ngraph::Node* node) {
+            return !ngraph::op::is_constant(node) && !ngraph::op::is_parameter(node) && !ngraph::op::is_output(node);
+        };
+        std::size_t size = 0;
+        for (auto&& node : function->get_ordered_ops()) {
+            if (!IsLayer(node.get())) {
+                continue;
+            }
+            auto& affinity = affinities.at(node->get_friendly_name());
+            for (auto&& output : node->outputs()) {
+                std::unordered_set<std::string> consumerDevices;
+                for (auto&& targetInput : output.get_target_inputs()) {
+                    if (IsLayer(targetInput.get_node())) {
+                        auto& consumerAffinity = affinities.at(targetInput.get_node()->get_friendly_name());
+                        if (consumerAffinity != affinity) {
+                            consumerDevices.insert(consumerAffinity);
+                        }
+                    }
+                }
+                size += consumerDevices.size() * output.get_element_type().size() *
+                        ngraph::shape_size(output.get_shape());
+            }
+        }
+        return size;
+    };
+    InferenceEngine::CNNNetwork network{function};
+    auto defaultAffinities = getCore()->QueryNetwork(network, targetDevice, configuration).supportedLayersMap;
+    configuration[HETERO_CONFIG_KEY(MINIMIZE_TRANSFERS)] = CONFIG_VALUE(YES);
+    auto minimizedAffinities = getCore()->QueryNetwork(network, targetDevice, configuration).supportedLayersMap;
+    for (auto&& node : function->get_ordered_ops()) {
+        ASSERT_TRUE(minimizedAffinities.count(node->get_friendly_name())) << node->get_friendly_name();
+    }
+    ASSERT_LE(TransfersSize(minimizedAffinities), TransfersSize(defaultAffinities));
+    Run();
+    ASSERT_NE(nullptr, cnnNetwork.getFunction());
+}
+
 }  //  namespace HeteroTests
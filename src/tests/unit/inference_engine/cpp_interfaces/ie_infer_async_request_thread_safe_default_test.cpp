@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <atomic>
 #include <deque>
 
 #include <gtest/gtest.h>
@@ -194,3 +195,19 @@ TEST_F(InferRequestThreadSafeDefaultTests, canCatchExceptionIfAsyncRequestFailed
     testRequest->StartAsync();
     EXPECT_THROW(testRequest->Wait(InferRequest::WaitMode::RESULT_READY), std::exception);
 }
+
+TEST_F(InferRequestThreadSafeDefaultTests, canRestartRequestManyTimes) {
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>();
+    testRequest = make_shared<AsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    constexpr int numRuns = 100;
+    std::atomic<int> numCallbacks{0};
+    testRequest->SetCallback([&](std::exception_ptr) {
+        numCallbacks++;
+    });
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).Times(numRuns);
+    for (int i = 0; i < numRuns; ++i) {
+        testRequest->StartAsync();
+        ASSERT_EQ(StatusCode::OK, testRequest->Wait(InferRequest::WaitMode::RESULT_READY));
+    }
+    ASSERT_EQ(numRuns, numCallbacks.load());
+}